@@ -0,0 +1,231 @@
+#pragma once
+
+#include <iterator>
+#include <ranges>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "utility_concepts.hpp"
+
+namespace alg
+{
+
+    namespace detail
+    {
+
+	// Asks for the cache line holding p where the compiler offers a way to;
+	// a no-op otherwise and during constant evaluation.
+	inline constexpr void prefetch([[maybe_unused]] const void* p) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+	    if(!std::is_constant_evaluated())
+		__builtin_prefetch(p);
+#endif
+	}
+
+	// First position in [left, right) for which before is false: probes at
+	// doubling distances from left, then binary searches the last step
+	template<std::random_access_iterator Iter, typename Pred>
+	constexpr auto gallop(Iter left, Iter right, Pred before) -> Iter
+	{
+	    using diff_t = std::iter_difference_t<Iter>;
+	    const diff_t n{right - left};
+
+	    diff_t low{}, high{1};
+	    for(; high <= n && before(left[high - 1]); high *= 2)
+		low = high;
+	    if(high > n)
+		high = n;
+
+	    while(low < high) {
+		const auto mid{low + (high - low) / 2};
+		if(before(left[mid]))
+		    low = mid + 1;
+		else
+		    high = mid;
+	    }
+	    return left + low;
+	}
+
+	// First position in [first, first + n) for which before is false. Every
+	// step halves the range by selecting between two positions, which
+	// compilers turn into a conditional move instead of a branch that is
+	// mispredicted half of the time. Both positions the next step may probe
+	// are prefetched while the current comparison is pending.
+	template<std::random_access_iterator Iter, typename Pred>
+	constexpr auto branchless_bisect(Iter first, std::iter_difference_t<Iter> n, Pred& before) -> Iter
+	{
+	    if(n == 0)
+		return first;
+
+	    while(n > 1) {
+		const auto half{n / 2};
+		n -= half;
+		if constexpr(std::contiguous_iterator<Iter>) {
+		    prefetch(std::to_address(first) + n / 2);
+		    prefetch(std::to_address(first) + (half + n / 2));
+		}
+		first = before(first[half]) ? first + half : first;
+	    }
+	    return first + static_cast<std::iter_difference_t<Iter>>(before(*first));
+	}
+
+	template<std::forward_iterator Iter, typename Pred>
+	constexpr auto forward_bisect(Iter first, std::iter_difference_t<Iter> n, Pred& before) -> Iter
+	{
+	    while(n > 0) {
+		const auto half{n / 2};
+		auto middle{std::ranges::next(first, half)};
+		if(before(*middle)) {
+		    first = ++middle;
+		    n -= half + 1;
+		}
+		else
+		    n = half;
+	    }
+	    return first;
+	}
+
+	template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent, typename Pred>
+	constexpr auto bisect(Iter first, Sent last, Pred before) -> Iter
+	{
+	    const auto n{std::ranges::distance(first, last)};
+	    if constexpr(std::random_access_iterator<Iter>)
+		return branchless_bisect(std::move(first), n, before);
+	    else
+		return forward_bisect(std::move(first), n, before);
+	}
+
+	template<typename Iter, typename Sent, typename T, typename Comp, typename Proj>
+	constexpr auto lower_bound(Iter first, Sent last, const T& value, Comp& f, Proj& p) -> Iter
+	{
+	    return bisect(std::move(first), std::move(last), [&] (auto&& e) -> bool {
+		return std::invoke(f, std::invoke(p, std::forward<decltype(e)>(e)), value);
+	    });
+	}
+
+	template<typename Iter, typename Sent, typename T, typename Comp, typename Proj>
+	constexpr auto upper_bound(Iter first, Sent last, const T& value, Comp& f, Proj& p) -> Iter
+	{
+	    return bisect(std::move(first), std::move(last), [&] (auto&& e) -> bool {
+		return !std::invoke(f, value, std::invoke(p, std::forward<decltype(e)>(e)));
+	    });
+	}
+
+    }
+
+    //********************** lower_bound ************************
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto lower_bound(Iter left, Sent right, const T& value, Comp f = {}, Proj p = {}) -> Iter
+    {
+	return detail::lower_bound(std::move(left), std::move(right), value, f, p);
+    }
+
+    template<std::ranges::forward_range Range,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto lower_bound(Range&& range, const T& value, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::lower_bound(std::begin(range), std::end(range), value, std::ref(f), std::ref(p));
+    }
+
+
+    //********************** upper_bound ************************
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto upper_bound(Iter left, Sent right, const T& value, Comp f = {}, Proj p = {}) -> Iter
+    {
+	return detail::upper_bound(std::move(left), std::move(right), value, f, p);
+    }
+
+    template<std::ranges::forward_range Range,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto upper_bound(Range&& range, const T& value, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::upper_bound(std::begin(range), std::end(range), value, std::ref(f), std::ref(p));
+    }
+
+
+    //********************** equal_range ************************
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto equal_range(Iter left, Sent right, const T& value, Comp f = {}, Proj p = {})
+	-> std::ranges::subrange<Iter>
+    {
+	auto first{detail::lower_bound(std::move(left), right, value, f, p)};
+	auto last{detail::upper_bound(first, std::move(right), value, f, p)};
+	return {std::move(first), std::move(last)};
+    }
+
+    template<std::ranges::forward_range Range,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto equal_range(Range&& range, const T& value, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_subrange_t<Range>
+    {
+	return ::alg::equal_range(std::begin(range), std::end(range), value, std::ref(f), std::ref(p));
+    }
+
+
+    //********************** binary_search **********************
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto binary_search(Iter left, Sent right, const T& value, Comp f = {}, Proj p = {}) -> bool
+    {
+	auto found{detail::lower_bound(std::move(left), right, value, f, p)};
+	return found != right && !std::invoke(f, value, std::invoke(p, *found));
+    }
+
+    template<std::ranges::forward_range Range,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<const T*,
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto binary_search(Range&& range, const T& value, Comp f = {}, Proj p = {}) -> bool
+    {
+	return ::alg::binary_search(std::begin(range), std::end(range), value, std::ref(f), std::ref(p));
+    }
+
+
+    //********************* partition_point *********************
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Proj = std::identity,
+	std::indirect_unary_predicate<std::projected<Iter, Proj>> Pred>
+    [[nodiscard]] constexpr auto partition_point(Iter left, Sent right, Pred f, Proj p = {}) -> Iter
+    {
+	return detail::bisect(std::move(left), std::move(right), [&] (auto&& e) -> bool {
+	    return std::invoke(f, std::invoke(p, std::forward<decltype(e)>(e)));
+	});
+    }
+
+    template<std::ranges::forward_range Range,
+	typename Proj = std::identity,
+	std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Range>, Proj>> Pred>
+    [[nodiscard]] constexpr auto partition_point(Range&& range, Pred f, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::partition_point(std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+}
@@ -0,0 +1,751 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "utility_concepts.hpp"
+#include "set_operations.hpp"
+#include "comparison_operations.hpp"
+
+namespace alg
+{
+
+    //******************** compressed_set ***********************
+
+    // Sorted set of 32-bit integers split into chunks of 2^16 values sharing
+    // their high half. A chunk keeps its low halves as a sorted array while
+    // sparse, as a bitmap once it holds more than 4096 values, and as a list
+    // of runs when optimize() finds that smaller.
+    class compressed_set
+    {
+    public:
+	using value_type = std::uint32_t;
+	using size_type = std::size_t;
+
+	class iterator;
+	using const_iterator = iterator;
+
+	compressed_set() = default;
+
+	compressed_set(std::initializer_list<value_type> values) : compressed_set(std::begin(values), std::end(values)) {}
+
+	template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+	requires std::convertible_to<std::iter_reference_t<Iter>, value_type>
+	compressed_set(Iter left, Sent right)
+	{
+	    for(; left != right; ++left)
+		insert(*left);
+	}
+
+	[[nodiscard]] auto size() const noexcept -> size_type { return count; }
+	[[nodiscard]] auto empty() const noexcept -> bool { return count == 0; }
+
+	void clear() noexcept
+	{
+	    chunks.clear();
+	    count = 0;
+	}
+
+	[[nodiscard]] auto begin() const -> iterator;
+	[[nodiscard]] auto end() const -> iterator;
+
+	[[nodiscard]] auto contains(value_type value) const -> bool
+	{
+	    const auto chunk{find(high(value))};
+	    return chunk != std::end(chunks) && chunk->key == high(value) && contains(chunk->data, low(value));
+	}
+
+	auto insert(value_type value) -> bool
+	{
+	    auto chunk{find(high(value))};
+	    if(chunk == std::end(chunks) || chunk->key != high(value))
+		chunk = chunks.insert(chunk, {high(value), array_container{}});
+
+	    const bool inserted{insert(chunk->data, low(value))};
+	    count += inserted;
+	    return inserted;
+	}
+
+	// Appending in ascending order, as std::back_inserter does for the
+	// output of a set operation, only ever touches the last chunk
+	void push_back(value_type value)
+	{
+	    if(chunks.empty() || chunks.back().key < high(value)) {
+		chunks.push_back({high(value), array_container{{low(value)}}});
+		++count;
+	    }
+	    else if(auto* array{std::get_if<array_container>(&chunks.back().data)};
+		    chunks.back().key == high(value) && array && array->values.back() < low(value) &&
+		    std::size(array->values) < array_limit) {
+		array->values.push_back(low(value));
+		++count;
+	    }
+	    else
+		insert(value);
+	}
+
+	// Converts every chunk to whichever of the three layouts is smallest
+	void optimize()
+	{
+	    for(auto& chunk : chunks) {
+		const auto runs{to_runs(chunk.data)};
+		const auto cardinality{size(chunk.data)};
+		const auto run_bytes{std::size(runs.runs) * sizeof(run)};
+		const auto array_bytes{cardinality * sizeof(std::uint16_t)};
+
+		if(run_bytes < std::min(array_bytes, bitmap_bytes))
+		    chunk.data = runs;
+		else if(std::holds_alternative<run_container>(chunk.data))
+		    chunk.data = normalize(to_bitmap(chunk.data));
+	    }
+	}
+
+	// Approximate heap usage of the chunk payloads
+	[[nodiscard]] auto memory_usage() const -> size_type
+	{
+	    size_type bytes{std::size(chunks) * sizeof(chunk_entry)};
+	    for(const auto& chunk : chunks)
+		bytes += std::visit(overloaded{
+		    [] (const array_container& c) { return std::size(c.values) * sizeof(std::uint16_t); },
+		    [] (const bitmap_container&) { return bitmap_bytes; },
+		    [] (const run_container& c) { return std::size(c.runs) * sizeof(run); }}, chunk.data);
+	    return bytes;
+	}
+
+	[[nodiscard]] auto includes(const compressed_set& other) const -> bool
+	{
+	    auto chunk{std::begin(chunks)};
+	    for(const auto& needle : other.chunks) {
+		while(chunk != std::end(chunks) && chunk->key < needle.key)
+		    ++chunk;
+		if(chunk == std::end(chunks) || chunk->key != needle.key || !includes(chunk->data, needle.data))
+		    return false;
+	    }
+	    return true;
+	}
+
+	friend auto operator&(const compressed_set& a, const compressed_set& b) -> compressed_set
+	{
+	    compressed_set result;
+	    for(auto i{std::begin(a.chunks)}, j{std::begin(b.chunks)}; i != std::end(a.chunks) && j != std::end(b.chunks);) {
+		if(i->key < j->key)
+		    ++i;
+		else if(j->key < i->key)
+		    ++j;
+		else {
+		    result.append(i->key, intersect(i->data, j->data));
+		    ++i, ++j;
+		}
+	    }
+	    return result;
+	}
+
+	friend auto operator|(const compressed_set& a, const compressed_set& b) -> compressed_set
+	{
+	    compressed_set result;
+	    auto i{std::begin(a.chunks)}, j{std::begin(b.chunks)};
+	    while(i != std::end(a.chunks) && j != std::end(b.chunks)) {
+		if(i->key < j->key)
+		    result.append(i->key, i->data), ++i;
+		else if(j->key < i->key)
+		    result.append(j->key, j->data), ++j;
+		else {
+		    result.append(i->key, unite(i->data, j->data));
+		    ++i, ++j;
+		}
+	    }
+	    for(; i != std::end(a.chunks); ++i)
+		result.append(i->key, i->data);
+	    for(; j != std::end(b.chunks); ++j)
+		result.append(j->key, j->data);
+	    return result;
+	}
+
+	friend auto operator-(const compressed_set& a, const compressed_set& b) -> compressed_set
+	{
+	    compressed_set result;
+	    auto j{std::begin(b.chunks)};
+	    for(const auto& chunk : a.chunks) {
+		while(j != std::end(b.chunks) && j->key < chunk.key)
+		    ++j;
+		if(j != std::end(b.chunks) && j->key == chunk.key)
+		    result.append(chunk.key, subtract(chunk.data, j->data));
+		else
+		    result.append(chunk.key, chunk.data);
+	    }
+	    return result;
+	}
+
+	auto operator&=(const compressed_set& other) -> compressed_set& { return *this = *this & other; }
+	auto operator|=(const compressed_set& other) -> compressed_set& { return *this = *this | other; }
+	auto operator-=(const compressed_set& other) -> compressed_set& { return *this = *this - other; }
+
+	friend auto operator==(const compressed_set& a, const compressed_set& b) -> bool;
+
+    private:
+	static constexpr std::size_t array_limit{4096};
+	static constexpr std::size_t bitmap_words{1024};
+	static constexpr std::size_t bitmap_bytes{bitmap_words * sizeof(std::uint64_t)};
+	static constexpr std::uint32_t chunk_end{1 << 16};
+
+	struct array_container
+	{
+	    std::vector<std::uint16_t> values;
+	};
+
+	struct bitmap_container
+	{
+	    std::vector<std::uint64_t> words = std::vector<std::uint64_t>(bitmap_words);
+	    std::size_t cardinality{};
+	};
+
+	// Inclusive range of low halves
+	struct run
+	{
+	    std::uint16_t first, last;
+	};
+
+	struct run_container
+	{
+	    std::vector<run> runs;
+	};
+
+	using container = std::variant<array_container, bitmap_container, run_container>;
+
+	struct chunk_entry
+	{
+	    std::uint16_t key;
+	    container data;
+	};
+
+	template<typename... F>
+	struct overloaded : F... { using F::operator()...; };
+
+	static auto high(value_type value) -> std::uint16_t { return static_cast<std::uint16_t>(value >> 16); }
+	static auto low(value_type value) -> std::uint16_t { return static_cast<std::uint16_t>(value); }
+
+	auto find(std::uint16_t key) const -> std::vector<chunk_entry>::const_iterator
+	{
+	    return ::alg::lower_bound(chunks, key, {}, &chunk_entry::key);
+	}
+
+	auto find(std::uint16_t key) -> std::vector<chunk_entry>::iterator
+	{
+	    return ::alg::lower_bound(chunks, key, {}, &chunk_entry::key);
+	}
+
+	void append(std::uint16_t key, container data)
+	{
+	    if(const auto n{size(data)}; n != 0) {
+		chunks.push_back({key, std::move(data)});
+		count += n;
+	    }
+	}
+
+	static auto test(const bitmap_container& c, std::uint32_t value) -> bool
+	{
+	    return (c.words[value >> 6] >> (value & 63)) & 1;
+	}
+
+	static void set(bitmap_container& c, std::uint32_t value)
+	{
+	    c.words[value >> 6] |= std::uint64_t{1} << (value & 63);
+	}
+
+	static void recount(bitmap_container& c)
+	{
+	    c.cardinality = 0;
+	    for(auto word : c.words)
+		c.cardinality += static_cast<std::size_t>(std::popcount(word));
+	}
+
+	// First set bit at or after from, chunk_end if there is none
+	static auto next_bit(const bitmap_container& c, std::uint32_t from) -> std::uint32_t
+	{
+	    if(from >= chunk_end)
+		return chunk_end;
+
+	    auto w{from >> 6};
+	    auto word{c.words[w] & (~std::uint64_t{} << (from & 63))};
+	    while(word == 0) {
+		if(++w == bitmap_words)
+		    return chunk_end;
+		word = c.words[w];
+	    }
+	    return w * 64 + static_cast<std::uint32_t>(std::countr_zero(word));
+	}
+
+	static auto size(const container& c) -> std::size_t
+	{
+	    return std::visit(overloaded{
+		[] (const array_container& a) { return std::size(a.values); },
+		[] (const bitmap_container& b) { return b.cardinality; },
+		[] (const run_container& r) {
+		    std::size_t n{};
+		    for(const auto& run : r.runs)
+			n += std::size_t{run.last} - run.first + 1;
+		    return n;
+		}}, c);
+	}
+
+	static auto contains(const container& c, std::uint16_t value) -> bool
+	{
+	    return std::visit(overloaded{
+		[&] (const array_container& a) { return ::alg::binary_search(a.values, value); },
+		[&] (const bitmap_container& b) { return test(b, value); },
+		[&] (const run_container& r) {
+		    const auto i{::alg::upper_bound(r.runs, value, {}, &run::first)};
+		    return i != std::begin(r.runs) && value <= std::prev(i)->last;
+		}}, c);
+	}
+
+	static auto to_bitmap(const container& c) -> bitmap_container
+	{
+	    if(const auto* bitmap{std::get_if<bitmap_container>(&c)})
+		return *bitmap;
+
+	    bitmap_container result;
+	    if(const auto* array{std::get_if<array_container>(&c)})
+		for(auto value : array->values)
+		    set(result, value);
+	    else
+		for(const auto& run : std::get<run_container>(c).runs)
+		    for(std::uint32_t value{run.first}; value <= run.last; ++value)
+			set(result, value);
+	    result.cardinality = size(c);
+	    return result;
+	}
+
+	static auto to_array(const bitmap_container& c) -> array_container
+	{
+	    array_container result;
+	    result.values.reserve(c.cardinality);
+	    for(auto value{next_bit(c, 0)}; value != chunk_end; value = next_bit(c, value + 1))
+		result.values.push_back(static_cast<std::uint16_t>(value));
+	    return result;
+	}
+
+	static auto to_runs(const container& c) -> run_container
+	{
+	    run_container result;
+	    const auto extend = [&] (std::uint32_t value) {
+		if(!result.runs.empty() && result.runs.back().last + 1u == value)
+		    result.runs.back().last = static_cast<std::uint16_t>(value);
+		else
+		    result.runs.push_back({static_cast<std::uint16_t>(value), static_cast<std::uint16_t>(value)});
+	    };
+
+	    std::visit(overloaded{
+		[&] (const array_container& a) { for(auto value : a.values) extend(value); },
+		[&] (const bitmap_container& b) {
+		    for(auto value{next_bit(b, 0)}; value != chunk_end; value = next_bit(b, value + 1))
+			extend(value);
+		},
+		[&] (const run_container& r) { result = r; }}, c);
+	    return result;
+	}
+
+	// Picks the array or bitmap layout by cardinality
+	static auto normalize(bitmap_container c) -> container
+	{
+	    if(c.cardinality <= array_limit)
+		return to_array(c);
+	    return c;
+	}
+
+	static auto normalize(array_container c) -> container
+	{
+	    if(std::size(c.values) > array_limit)
+		return to_bitmap(container{std::move(c)});
+	    return c;
+	}
+
+	static auto insert(container& c, std::uint16_t value) -> bool
+	{
+	    if(std::holds_alternative<run_container>(c)) {
+		if(contains(c, value))
+		    return false;
+		c = normalize(to_bitmap(c));
+	    }
+
+	    if(auto* array{std::get_if<array_container>(&c)}) {
+		const auto i{::alg::lower_bound(array->values, value)};
+		if(i != std::end(array->values) && *i == value)
+		    return false;
+		if(std::size(array->values) < array_limit) {
+		    array->values.insert(i, value);
+		    return true;
+		}
+		c = to_bitmap(c);
+	    }
+
+	    auto& bitmap{std::get<bitmap_container>(c)};
+	    if(test(bitmap, value))
+		return false;
+	    set(bitmap, value);
+	    ++bitmap.cardinality;
+	    return true;
+	}
+
+	static auto intersect(const container& a, const container& b) -> container
+	{
+	    const auto* left{std::get_if<array_container>(&a)};
+	    const auto* right{std::get_if<array_container>(&b)};
+
+	    if(left && right) {
+		array_container result;
+		::alg::set_intersection(left->values, right->values, std::back_inserter(result.values));
+		return result;
+	    }
+
+	    if(left || right) {
+		const auto& array{left ? *left : *right};
+		const auto& other{left ? b : a};
+		array_container result;
+		for(auto value : array.values)
+		    if(contains(other, value))
+			result.values.push_back(value);
+		return result;
+	    }
+
+	    auto result{to_bitmap(a)};
+	    const auto mask{to_bitmap(b)};
+	    for(std::size_t w{}; w != bitmap_words; ++w)
+		result.words[w] &= mask.words[w];
+	    recount(result);
+	    return normalize(std::move(result));
+	}
+
+	static auto unite(const container& a, const container& b) -> container
+	{
+	    const auto* left{std::get_if<array_container>(&a)};
+	    const auto* right{std::get_if<array_container>(&b)};
+
+	    if(left && right) {
+		array_container result;
+		::alg::set_union(left->values, right->values, std::back_inserter(result.values));
+		return normalize(std::move(result));
+	    }
+
+	    auto result{to_bitmap(a)};
+	    if(right)
+		for(auto value : right->values)
+		    set(result, value);
+	    else {
+		const auto other{to_bitmap(b)};
+		for(std::size_t w{}; w != bitmap_words; ++w)
+		    result.words[w] |= other.words[w];
+	    }
+	    recount(result);
+	    return normalize(std::move(result));
+	}
+
+	static auto subtract(const container& a, const container& b) -> container
+	{
+	    if(const auto* left{std::get_if<array_container>(&a)}) {
+		array_container result;
+		if(const auto* right{std::get_if<array_container>(&b)})
+		    ::alg::set_difference(left->values, right->values, std::back_inserter(result.values));
+		else
+		    for(auto value : left->values)
+			if(!contains(b, value))
+			    result.values.push_back(value);
+		return result;
+	    }
+
+	    auto result{to_bitmap(a)};
+	    if(const auto* right{std::get_if<array_container>(&b)})
+		for(auto value : right->values)
+		    result.words[value >> 6] &= ~(std::uint64_t{1} << (value & 63));
+	    else {
+		const auto other{to_bitmap(b)};
+		for(std::size_t w{}; w != bitmap_words; ++w)
+		    result.words[w] &= ~other.words[w];
+	    }
+	    recount(result);
+	    return normalize(std::move(result));
+	}
+
+	// Whether every value of needle is in haystack
+	static auto includes(const container& haystack, const container& needle) -> bool
+	{
+	    if(size(needle) > size(haystack))
+		return false;
+
+	    if(const auto* array{std::get_if<array_container>(&needle)}) {
+		if(const auto* values{std::get_if<array_container>(&haystack)})
+		    return ::alg::includes(values->values, array->values);
+		return ::alg::all_of(array->values, [&] (auto value) { return contains(haystack, value); });
+	    }
+
+	    const auto inner{to_bitmap(needle)};
+	    const auto outer{to_bitmap(haystack)};
+	    for(std::size_t w{}; w != bitmap_words; ++w)
+		if(inner.words[w] & ~outer.words[w])
+		    return false;
+	    return true;
+	}
+
+	std::vector<chunk_entry> chunks;
+	size_type count{};
+    };
+
+
+    class compressed_set::iterator
+    {
+    public:
+	// Values are computed on dereference, so a legacy forward iterator's
+	// reference requirement cannot be met
+	using iterator_concept = std::forward_iterator_tag;
+	using iterator_category = std::input_iterator_tag;
+	using value_type = compressed_set::value_type;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type;
+
+	iterator() = default;
+
+	auto operator*() const -> value_type
+	{
+	    return value_type{set->chunks[index].key} << 16 | current;
+	}
+
+	auto operator++() -> iterator&
+	{
+	    const auto& data{set->chunks[index].data};
+	    if(const auto* array{std::get_if<array_container>(&data)}) {
+		if(++position != std::size(array->values)) {
+		    current = array->values[position];
+		    return *this;
+		}
+	    }
+	    else if(const auto* bitmap{std::get_if<bitmap_container>(&data)}) {
+		if(const auto next{next_bit(*bitmap, current + 1)}; next != chunk_end) {
+		    current = next;
+		    return *this;
+		}
+	    }
+	    else {
+		const auto& runs{std::get<run_container>(data).runs};
+		if(current != runs[position].last) {
+		    ++current;
+		    return *this;
+		}
+		if(++position != std::size(runs)) {
+		    current = runs[position].first;
+		    return *this;
+		}
+	    }
+
+	    ++index;
+	    enter();
+	    return *this;
+	}
+
+	auto operator++(int) -> iterator
+	{
+	    auto old{*this};
+	    ++*this;
+	    return old;
+	}
+
+	auto operator==(const iterator& other) const -> bool
+	{
+	    if(set != other.set)
+		return false;
+	    return set == nullptr ||
+		(index == other.index && (index == std::size(set->chunks) || current == other.current));
+	}
+
+    private:
+	friend class compressed_set;
+
+	iterator(const compressed_set* set, std::size_t index) : set{set}, index{index}
+	{
+	    enter();
+	}
+
+	// Positions the iterator on the first value of the chunk at index
+	void enter()
+	{
+	    position = 0;
+	    if(index == std::size(set->chunks))
+		return;
+
+	    const auto& data{set->chunks[index].data};
+	    if(const auto* array{std::get_if<array_container>(&data)})
+		current = array->values.front();
+	    else if(const auto* bitmap{std::get_if<bitmap_container>(&data)})
+		current = next_bit(*bitmap, 0);
+	    else
+		current = std::get<run_container>(data).runs.front().first;
+	}
+
+	const compressed_set* set{};
+	std::size_t index{};
+	std::size_t position{};
+	std::uint32_t current{};
+    };
+
+    inline auto compressed_set::begin() const -> iterator
+    {
+	return {this, 0};
+    }
+
+    inline auto compressed_set::end() const -> iterator
+    {
+	return {this, std::size(chunks)};
+    }
+
+    inline auto operator==(const compressed_set& a, const compressed_set& b) -> bool
+    {
+	return std::size(a) == std::size(b) && ::alg::equal(a, b);
+    }
+
+
+    //**************** compressed_set_inserter ******************
+
+    // Output iterator appending to a compressed_set like std::back_inserter,
+    // that also lets set operations reach the set to combine whole chunks
+    class compressed_set_inserter
+    {
+    public:
+	using difference_type = std::ptrdiff_t;
+
+	compressed_set_inserter() = default;
+	explicit compressed_set_inserter(compressed_set& set) : set{&set} {}
+
+	auto operator=(compressed_set::value_type value) -> compressed_set_inserter&
+	{
+	    set->push_back(value);
+	    return *this;
+	}
+
+	auto operator*() -> compressed_set_inserter& { return *this; }
+	auto operator++() -> compressed_set_inserter& { return *this; }
+	auto operator++(int) -> compressed_set_inserter { return *this; }
+
+	[[nodiscard]] auto target() const -> compressed_set& { return *set; }
+
+    private:
+	compressed_set* set{};
+    };
+
+    [[nodiscard]] inline auto compressed_inserter(compressed_set& set) -> compressed_set_inserter
+    {
+	return compressed_set_inserter{set};
+    }
+
+
+    namespace detail
+    {
+
+	template<typename Range>
+	concept compressed_set_range = std::same_as<std::remove_cvref_t<Range>, compressed_set>;
+
+	template<typename Comp, typename Proj1, typename Proj2>
+	concept natural_order = concepts::default_less<Comp> &&
+	    concepts::identity_projection<Proj1> &&
+	    concepts::identity_projection<Proj2>;
+
+	// Same effect as pushing every value of result through out
+	inline void insert_all(compressed_set_inserter& out, compressed_set&& result)
+	{
+	    auto& target{out.target()};
+	    if(target.empty())
+		target = std::move(result);
+	    else
+		target |= result;
+	}
+
+    }
+
+
+    // The overloads below repeat the template heads of the generic range
+    // overloads and add constraints, so they win whenever two compressed sets
+    // are combined into a third one through a compressed_set_inserter and
+    // work chunk by chunk instead of value by value
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    requires detail::compressed_set_range<Range1> && detail::compressed_set_range<Range2> &&
+	detail::natural_order<Comp, Proj1, Proj2>
+    [[nodiscard]] auto includes(Range1&& range1, Range2&& range2,
+	    Comp = {}, Proj1 = {}, Proj2 = {}) -> bool
+    {
+	return range1.includes(range2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Out, Comp, Proj1, Proj2> &&
+	detail::compressed_set_range<Range1> && detail::compressed_set_range<Range2> &&
+	std::same_as<Out, compressed_set_inserter> &&
+	detail::natural_order<Comp, Proj1, Proj2>
+    auto set_difference(Range1&& range1, Range2&& range2,
+	Out out, Comp = {}, Proj1 = {}, Proj2 = {}) -> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range1>, Out>
+    {
+	detail::insert_all(out, range1 - range2);
+	return {std::end(range1), std::move(out)};
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Out, Comp, Proj1, Proj2> &&
+	detail::compressed_set_range<Range1> && detail::compressed_set_range<Range2> &&
+	std::same_as<Out, compressed_set_inserter> &&
+	detail::natural_order<Comp, Proj1, Proj2>
+    auto set_intersection(Range1&& range1, Range2&& range2,
+	Out out, Comp = {}, Proj1 = {}, Proj2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	detail::insert_all(out, range1 & range2);
+	return {std::end(range1), std::end(range2), std::move(out)};
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Out, Comp, Proj1, Proj2> &&
+	detail::compressed_set_range<Range1> && detail::compressed_set_range<Range2> &&
+	std::same_as<Out, compressed_set_inserter> &&
+	detail::natural_order<Comp, Proj1, Proj2>
+    auto set_union(Range1&& range1, Range2&& range2,
+	Out out, Comp = {}, Proj1 = {}, Proj2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	detail::insert_all(out, range1 | range2);
+	return {std::end(range1), std::end(range2), std::move(out)};
+    }
+
+}
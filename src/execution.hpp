@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <iterator>
+
+#include "utility_concepts.hpp"
+
+namespace alg
+{
+
+    //****************** execution policies *********************
+
+    namespace execution
+    {
+
+	struct sequenced_policy {};
+	struct parallel_policy {};
+
+	inline constexpr sequenced_policy seq{};
+	inline constexpr parallel_policy par{};
+
+    }
+
+}
+
+
+namespace concepts
+{
+
+    template<typename T>
+    concept execution_policy = any_of<std::remove_cvref_t<T>,
+				      alg::execution::sequenced_policy,
+				      alg::execution::parallel_policy>;
+
+    template<typename T>
+    concept parallel_execution_policy = std::same_as<std::remove_cvref_t<T>, alg::execution::parallel_policy>;
+
+}
+
+
+namespace alg
+{
+
+    //********************** thread_pool ************************
+
+    class thread_pool
+    {
+    public:
+	explicit thread_pool(std::size_t threads = default_threads())
+	{
+	    workers.reserve(threads);
+	    for(std::size_t i{}; i != threads; ++i)
+		workers.emplace_back([this] { work(); });
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	~thread_pool()
+	{
+	    {
+		std::lock_guard lock{mutex};
+		stopping = true;
+	    }
+	    wake.notify_all();
+	}
+
+	// Number of threads taking part in run(), the calling thread included
+	[[nodiscard]] auto concurrency() const noexcept -> std::size_t
+	{
+	    return std::size(workers) + 1;
+	}
+
+	// Calls f(0), ..., f(n - 1) and returns once all calls have finished.
+	// The calling thread takes tasks as well, so nested calls cannot deadlock.
+	template<typename F>
+	void run(std::size_t n, F&& f)
+	{
+	    if(n == 0)
+		return;
+
+	    auto state{std::make_shared<run_state>(n)};
+	    auto drain = [state, &f] {
+		for(std::size_t i; (i = state->next.fetch_add(1)) < state->count;) {
+		    try {
+			std::invoke(f, i);
+		    } catch(...) {
+			std::lock_guard lock{state->mutex};
+			if(!state->error)
+			    state->error = std::current_exception();
+		    }
+
+		    if(state->done.fetch_add(1) + 1 == state->count) {
+			std::lock_guard lock{state->mutex};
+			state->finished.notify_all();
+		    }
+		}
+	    };
+
+	    {
+		std::lock_guard lock{mutex};
+		for(std::size_t i{}, helpers{std::min(n - 1, std::size(workers))}; i != helpers; ++i)
+		    tasks.emplace_back(drain);
+	    }
+	    wake.notify_all();
+
+	    drain();
+
+	    std::unique_lock lock{state->mutex};
+	    state->finished.wait(lock, [&] { return state->done == state->count; });
+	    if(state->error)
+		std::rethrow_exception(state->error);
+	}
+
+	[[nodiscard]] static auto instance() -> thread_pool&
+	{
+	    static thread_pool pool;
+	    return pool;
+	}
+
+    private:
+	struct run_state
+	{
+	    explicit run_state(std::size_t n) : count{n} {}
+
+	    const std::size_t count;
+	    std::atomic<std::size_t> next{};
+	    std::atomic<std::size_t> done{};
+	    std::mutex mutex;
+	    std::condition_variable finished;
+	    std::exception_ptr error;
+	};
+
+	static auto default_threads() -> std::size_t
+	{
+	    const auto hardware{std::thread::hardware_concurrency()};
+	    return hardware > 1 ? hardware - 1 : 0;
+	}
+
+	void work()
+	{
+	    for(;;) {
+		std::function<void()> task;
+		{
+		    std::unique_lock lock{mutex};
+		    wake.wait(lock, [this] { return stopping || !tasks.empty(); });
+		    if(stopping && tasks.empty())
+			return;
+		    task = std::move(tasks.front());
+		    tasks.pop_front();
+		}
+		task();
+	    }
+	}
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::deque<std::function<void()>> tasks;
+	bool stopping{false};
+	std::vector<std::jthread> workers;
+    };
+
+
+    namespace detail
+    {
+
+	inline constexpr std::size_t parallel_grain{1 << 14};
+
+	// Splits [0, n) into at most a few chunks per thread, none smaller than grain
+	[[nodiscard]] inline auto chunk_count(std::size_t n, std::size_t grain = parallel_grain) -> std::size_t
+	{
+	    const auto by_size{std::max<std::size_t>(n / grain, 1)};
+	    return std::min(by_size, 4 * thread_pool::instance().concurrency());
+	}
+
+	[[nodiscard]] inline auto chunk_bounds(std::size_t chunk, std::size_t chunks, std::size_t n)
+	    -> std::pair<std::size_t, std::size_t>
+	{
+	    return {n * chunk / chunks, n * (chunk + 1) / chunks};
+	}
+
+	// Calls f(chunk, first, last) for every chunk of [0, n) on the shared pool
+	template<typename F>
+	void for_each_chunk(std::size_t chunks, std::size_t n, F&& f)
+	{
+	    thread_pool::instance().run(chunks, [&] (std::size_t chunk) {
+		const auto [first, last]{chunk_bounds(chunk, chunks, n)};
+		std::invoke(f, chunk, first, last);
+	    });
+	}
+
+	// Applies search to every chunk of [left, left + n) and collects the results in chunk order
+	template<std::random_access_iterator Iter, typename Search>
+	auto search_chunks(Iter left, std::size_t n, std::size_t chunks, Search search)
+	{
+	    using diff_t = std::iter_difference_t<Iter>;
+	    using result_t = std::invoke_result_t<Search&, Iter, Iter>;
+
+	    std::vector<result_t> results(chunks);
+	    for_each_chunk(chunks, n, [&] (std::size_t chunk, std::size_t first, std::size_t last) {
+		results[chunk] = std::invoke(search, left + static_cast<diff_t>(first), left + static_cast<diff_t>(last));
+	    });
+	    return results;
+	}
+
+    }
+
+}
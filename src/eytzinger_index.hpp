@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utility_concepts.hpp"
+#include "binary_search_operations.hpp"
+
+namespace alg
+{
+
+    namespace detail
+    {
+
+	// Hands out storage starting on a cache line boundary
+	template<typename T>
+	struct cache_line_allocator
+	{
+	    using value_type = T;
+
+	    static constexpr std::align_val_t alignment{std::max<std::size_t>(64, alignof(T))};
+
+	    cache_line_allocator() = default;
+
+	    template<typename U>
+	    cache_line_allocator(const cache_line_allocator<U>&) noexcept {}
+
+	    [[nodiscard]] auto allocate(std::size_t n) -> T*
+	    {
+		return static_cast<T*>(::operator new(n * sizeof(T), alignment));
+	    }
+
+	    void deallocate(T* p, std::size_t n) noexcept
+	    {
+		::operator delete(p, n * sizeof(T), alignment);
+	    }
+
+	    friend auto operator==(const cache_line_allocator&, const cache_line_allocator&) -> bool = default;
+	};
+
+    }
+
+
+    //******************** eytzinger_index **********************
+
+    // Read-only search structure over the projected keys of a sorted range.
+    // Keys are stored in breadth-first order of an implicit binary search
+    // tree (node k has children 2k and 2k + 1), so the first levels of every
+    // search share a few cache lines and the nodes a query may visit several
+    // levels down sit next to each other and can be prefetched as one block.
+    // Node k lives in slot k of cache line aligned storage, slot 0 is unused.
+    // Queries answer with positions in the range the index was built from.
+    template<typename T, typename Comp = std::ranges::less>
+    requires std::strict_weak_order<Comp&, const T&, const T&> && std::default_initializable<T>
+    class eytzinger_index
+    {
+    public:
+	using key_type = T;
+	using size_type = std::size_t;
+	using key_compare = Comp;
+
+	eytzinger_index() = default;
+
+	template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent, typename Proj = std::identity>
+	requires std::constructible_from<T, std::indirect_result_t<Proj&, Iter>>
+	eytzinger_index(Iter left, Sent right, Comp f = {}, Proj p = {}) : comp(std::move(f))
+	{
+	    keys.resize(static_cast<size_type>(std::ranges::distance(left, right)) + 1);
+	    place(1, left, p);
+	}
+
+	template<std::ranges::forward_range Range, typename Proj = std::identity>
+	requires std::constructible_from<T, std::indirect_result_t<Proj&, std::ranges::iterator_t<Range>>>
+	explicit eytzinger_index(Range&& range, Comp f = {}, Proj p = {})
+	    : eytzinger_index(std::ranges::begin(range), std::ranges::end(range), std::move(f), std::move(p)) {}
+
+	[[nodiscard]] auto size() const noexcept -> size_type { return std::size(keys) - 1; }
+	[[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+	// Position of the first key not ordered before value, or size()
+	[[nodiscard]] auto lower_bound(const T& value) const -> size_type
+	{
+	    return position(descend([&] (const T& key) { return std::invoke(comp, key, value); }));
+	}
+
+	// Position of the first key value is ordered before, or size()
+	[[nodiscard]] auto upper_bound(const T& value) const -> size_type
+	{
+	    return position(descend([&] (const T& key) { return !std::invoke(comp, value, key); }));
+	}
+
+	[[nodiscard]] auto contains(const T& value) const -> bool
+	{
+	    const auto leaf{descend([&] (const T& key) { return std::invoke(comp, key, value); })};
+	    const auto slot{leaf >> (std::countr_one(leaf) + 1)};
+	    return slot != 0 && !std::invoke(comp, value, keys[slot]);
+	}
+
+    private:
+	// Nodes per cache line; the 2^d descendants d levels below node k are
+	// the consecutive slots starting at k * 2^d. With d chosen to fill a
+	// line and slot 0 on a line boundary, that block starts a line whenever
+	// the key size is a power of two, so a single prefetch covers a whole
+	// level of the subtree.
+	static constexpr size_type block{std::max<size_type>(1, std::bit_floor(64 / std::max<size_type>(1, sizeof(T))))};
+
+	// In-order walk of the implicit tree meets the slots in sorted order,
+	// so they are filled straight from the input in one pass
+	template<typename Iter, typename Proj>
+	void place(size_type k, Iter& it, Proj& p)
+	{
+	    if(k > size())
+		return;
+	    place(2 * k, it, p);
+	    keys[k] = T(std::invoke(p, *it));
+	    ++it;
+	    place(2 * k + 1, it, p);
+	}
+
+	// Walks down while before holds on the right, appending one bit per
+	// level to k, and returns the empty child slot the walk falls out at.
+	// The node the answer sits in is where the path last turned left, k
+	// with its trailing right turns and that left turn stripped.
+	template<typename Pred>
+	auto descend(Pred before) const -> size_type
+	{
+	    const auto n{size()};
+	    const T* data{keys.data()};
+	    size_type k{1};
+	    while(k <= n) {
+		detail::prefetch(data + std::min(k * block, n));
+		k = 2 * k + static_cast<size_type>(before(data[k]));
+	    }
+	    return k;
+	}
+
+	// The n + 1 empty child slots n < k <= 2n + 1 are the gaps between the
+	// keys in order: first those below the last level, left to right, then
+	// the unused tail of the last level. The gap the walk ends in counts the
+	// keys before it, so no table of original positions is needed.
+	auto position(size_type k) const -> size_type
+	{
+	    const auto n{size()};
+	    const auto deepest{std::bit_floor(2 * n + 1)};
+	    return k >= deepest ? k - deepest : k + n + 1 - deepest;
+	}
+
+	std::vector<T, detail::cache_line_allocator<T>> keys = std::vector<T, detail::cache_line_allocator<T>>(1);
+	[[no_unique_address]] Comp comp{};
+    };
+
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    eytzinger_index(Iter, Sent, Comp = {}, Proj = {})
+	-> eytzinger_index<std::remove_cvref_t<std::indirect_result_t<Proj&, Iter>>, Comp>;
+
+    template<std::ranges::forward_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    eytzinger_index(Range&&, Comp = {}, Proj = {})
+	-> eytzinger_index<std::remove_cvref_t<std::indirect_result_t<Proj&, std::ranges::iterator_t<Range>>>, Comp>;
+
+}
@@ -4,10 +4,195 @@
 #include <ranges>
 #include <functional>
 #include <algorithm>
+#include <memory>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utility_concepts.hpp"
+#include "execution.hpp"
 
 namespace alg
 {
 
+    namespace detail
+    {
+
+	template<typename Iter, typename Sent, typename Comp, typename Proj>
+	concept lane_searchable = 
+	    std::contiguous_iterator<Iter> &&
+	    std::sized_sentinel_for<Sent, Iter> &&
+	    std::integral<std::iter_value_t<Iter>> &&
+	    concepts::default_less<Comp> &&
+	    concepts::identity_projection<Proj>;
+
+	inline constexpr std::size_t extremum_lanes{16};
+
+	// Each lane keeps its own running extremum and the index it was seen at,
+	// lanes are reduced at the end. Ties resolve as in the scalar loops:
+	// first maximum, last minimum.
+	template<bool Max, typename T>
+	auto lane_extremum(const T* data, std::size_t n) -> std::size_t
+	{
+	    constexpr auto lanes{extremum_lanes};
+	    const auto better = [] (const T& candidate, const T& current) {
+		if constexpr(Max)
+		    return current < candidate;
+		else
+		    return !(current < candidate);
+	    };
+
+	    std::size_t best_i{};
+	    std::size_t i{};
+
+	    if(n >= 2 * lanes) {
+		T value[lanes];
+		std::size_t index[lanes];
+		for(std::size_t l{}; l != lanes; ++l)
+		    value[l] = data[l], index[l] = l;
+
+		for(i = lanes; i + lanes <= n; i += lanes)
+		    for(std::size_t l{}; l != lanes; ++l) {
+			const bool b{better(data[i + l], value[l])};
+			value[l] = b ? data[i + l] : value[l];
+			index[l] = b ? i + l : index[l];
+		    }
+
+		best_i = index[0];
+		for(std::size_t l{1}; l != lanes; ++l) {
+		    const auto v{value[l]}, b{data[best_i]};
+		    if(v == b ? (Max ? index[l] < best_i : index[l] > best_i) : better(v, b))
+			best_i = index[l];
+		}
+	    } else
+		i = 1;
+
+	    for(; i < n; ++i)
+		if(better(data[i], data[best_i]))
+		    best_i = i;
+
+	    return best_i;
+	}
+
+
+	template<typename Iter, typename Out, typename T, typename Comp, typename Proj>
+	concept clamp_vectorizable = 
+	    concepts::bitwise_copyable<Iter, Out> &&
+	    std::is_arithmetic_v<std::iter_value_t<Iter>> &&
+	    std::same_as<std::iter_value_t<Iter>, T> &&
+	    concepts::default_less<Comp> &&
+	    concepts::identity_projection<Proj>;
+
+	// Same selection as clamp with less, NaN inputs pass through unchanged
+	template<typename T>
+	void clamp_kernel(const T* in, T* out, std::size_t n, const T l, const T h)
+	{
+	    for(std::size_t i{}; i != n; ++i) {
+		const T v{in[i]};
+		out[i] = v < l ? l : h < v ? h : v;
+	    }
+	}
+
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void heap_sift_down(Iter first, std::iter_difference_t<Iter> n,
+		std::iter_difference_t<Iter> i, Less& less)
+	{
+	    for(auto child{2 * i + 1}; child < n; i = child, child = 2 * i + 1) {
+		if(child + 1 < n && less(first[child], first[child + 1]))
+		    ++child;
+		if(!less(first[i], first[child]))
+		    return;
+		std::ranges::iter_swap(first + i, first + child);
+	    }
+	}
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void heap_sift_up(Iter first, std::iter_difference_t<Iter> i, Less& less)
+	{
+	    for(auto parent{(i - 1) / 2}; i > 0 && less(first[parent], first[i]); i = parent, parent = (i - 1) / 2)
+		std::ranges::iter_swap(first + i, first + parent);
+	}
+
+	// Keeps the k best elements seen so far in a heap with the worst one on top,
+	// equivalent elements seen earlier are preferred
+	template<typename Iter, typename Sent, typename Out, typename Comp, typename Proj>
+	constexpr auto best_k_elements(Iter left, Sent right, std::iter_difference_t<Iter> k, Out out, Comp& f, Proj& p)
+	    -> std::ranges::in_out_result<Iter, Out>
+	{
+	    using entry_t = std::pair<std::iter_value_t<Iter>, std::size_t>;
+	    using diff_t = std::ptrdiff_t;
+
+	    auto better = [&] (const entry_t& a, const entry_t& b) {
+		if(std::invoke(f, std::invoke(p, a.first), std::invoke(p, b.first)))
+		    return true;
+		if(std::invoke(f, std::invoke(p, b.first), std::invoke(p, a.first)))
+		    return false;
+		return a.second < b.second;
+	    };
+
+	    std::vector<entry_t> heap;
+	    if(k <= 0)
+		return {std::ranges::next(std::move(left), std::move(right)), std::move(out)};
+	    if constexpr(std::sized_sentinel_for<Sent, Iter>)
+		heap.reserve(static_cast<std::size_t>(std::min<std::iter_difference_t<Iter>>(k, right - left)));
+
+	    for(std::size_t seen{}; left != right; ++left, ++seen)
+		if(std::size(heap) < static_cast<std::size_t>(k)) {
+		    heap.emplace_back(*left, seen);
+		    heap_sift_up(std::begin(heap), static_cast<diff_t>(std::size(heap)) - 1, better);
+		} else if(std::invoke(f, std::invoke(p, *left), std::invoke(p, heap.front().first))) {
+		    heap.front() = entry_t(*left, seen);
+		    heap_sift_down(std::begin(heap), static_cast<diff_t>(std::size(heap)), diff_t{}, better);
+		}
+
+	    for(auto n{static_cast<diff_t>(std::size(heap))}; n > 1; --n) {
+		std::ranges::iter_swap(std::begin(heap), std::begin(heap) + (n - 1));
+		heap_sift_down(std::begin(heap), n - 1, diff_t{}, better);
+	    }
+
+	    for(auto& entry : heap)
+		*out++ = std::move(entry.first);
+
+	    return {std::move(left), std::move(out)};
+	}
+
+
+	// Holds a projected value between comparisons: by address when both the
+	// element and the projection yield references, by copy otherwise
+	template<std::indirectly_readable Iter, typename Proj>
+	class projection_cache
+	{
+	    using result_t = std::indirect_result_t<Proj&, Iter>;
+
+	    static constexpr bool by_address{
+		std::is_reference_v<std::iter_reference_t<Iter>> && std::is_reference_v<result_t>};
+
+	    std::conditional_t<by_address,
+		std::remove_reference_t<result_t>*,
+		std::optional<std::remove_cvref_t<result_t>>> cache;
+
+	public:
+	    template<typename R>
+	    requires (!std::same_as<std::remove_cvref_t<R>, projection_cache>)
+	    constexpr explicit projection_cache(R&& r)
+	    {
+		if constexpr(by_address)
+		    cache = std::addressof(r);
+		else
+		    cache.emplace(std::forward<R>(r));
+	    }
+
+	    constexpr auto get() -> decltype(auto)
+	    {
+		return *cache;
+	    }
+	};
+
+    }
+
     //**************** max_element ********************
 
     template<std::forward_iterator Iter, std::sentinel_for<Iter> Sent,
@@ -19,6 +204,10 @@ namespace alg
 	if(left == right)
 	    return right;
 
+	if constexpr(detail::lane_searchable<Iter, Sent, Comp, Proj>)
+	    if(!std::is_constant_evaluated())
+		return left + detail::lane_extremum<true>(std::to_address(left), right - left);
+
 	auto biggest = left++;
 	for(; left != right; ++left)
 	    if(std::invoke(f, std::invoke(p, *biggest), std::invoke(p, *left)))
@@ -38,6 +227,44 @@ namespace alg
     }
 
 
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter, std::sized_sentinel_for<Iter> Sent,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] auto max_element(Policy&&, Iter left, Sent right, Comp f = {}, Proj p = {})
+	-> Iter
+    {
+	const auto n{static_cast<std::size_t>(right - left)};
+	const auto chunks{concepts::parallel_execution_policy<Policy> ? detail::chunk_count(n) : 1};
+	if(chunks == 1)
+	    return ::alg::max_element(std::move(left), std::move(right), std::ref(f), std::ref(p));
+
+	auto found = detail::search_chunks(std::move(left), n, chunks, [&] (Iter l, Iter r) {
+	    return ::alg::max_element(std::move(l), std::move(r), std::ref(f), std::ref(p));
+	});
+
+	auto biggest{found[0]};
+	for(std::size_t i{1}; i != chunks; ++i)
+	    if(std::invoke(f, std::invoke(p, *biggest), std::invoke(p, *found[i])))
+		biggest = found[i];
+
+	return biggest;
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    requires std::ranges::sized_range<Range>
+    [[nodiscard]] auto max_element(Policy&& policy, Range&& range, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::max_element(std::forward<Policy>(policy), std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
     //******************** max ************************
 
     template<typename T,
@@ -96,6 +323,10 @@ namespace alg
 	if(left == right)
 	    return right;
 
+	if constexpr(detail::lane_searchable<Iter, Sent, Comp, Proj>)
+	    if(!std::is_constant_evaluated())
+		return left + detail::lane_extremum<false>(std::to_address(left), right - left);
+
 	auto smallest = left++;
 	for(; left != right; ++left)
 	    if(!std::invoke(f, std::invoke(p, *smallest), std::invoke(p, *left)))
@@ -115,6 +346,44 @@ namespace alg
     }
 
 
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter, std::sized_sentinel_for<Iter> Sent,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] auto min_element(Policy&&, Iter left, Sent right, Comp f = {}, Proj p = {})
+	-> Iter
+    {
+	const auto n{static_cast<std::size_t>(right - left)};
+	const auto chunks{concepts::parallel_execution_policy<Policy> ? detail::chunk_count(n) : 1};
+	if(chunks == 1)
+	    return ::alg::min_element(std::move(left), std::move(right), std::ref(f), std::ref(p));
+
+	auto found = detail::search_chunks(std::move(left), n, chunks, [&] (Iter l, Iter r) {
+	    return ::alg::min_element(std::move(l), std::move(r), std::ref(f), std::ref(p));
+	});
+
+	auto smallest{found[0]};
+	for(std::size_t i{1}; i != chunks; ++i)
+	    if(!std::invoke(f, std::invoke(p, *smallest), std::invoke(p, *found[i])))
+		smallest = found[i];
+
+	return smallest;
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    requires std::ranges::sized_range<Range>
+    [[nodiscard]] auto min_element(Policy&& policy, Range&& range, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::min_element(std::forward<Policy>(policy), std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
     //******************** min ************************
 
     template<typename T,
@@ -170,13 +439,39 @@ namespace alg
     [[nodiscard]] constexpr auto minmax_element(Iter left, Sent right, Comp f = {}, Proj p = {})
 	-> std::ranges::minmax_result<Iter>
     {
-	auto min = left, max = left;
+	using cache_t = detail::projection_cache<Iter, Proj>;
 
-	for(; left != right; ++left) {
-	    if(std::invoke(f, std::invoke(p, *left), std::invoke(p, *min)))
-		min = left;
-	    else if(!std::invoke(f, std::invoke(p, *left), std::invoke(p, *max)))
-		max = left;
+	auto min = left, max = left;
+	if(left == right)
+	    return {min, max};
+
+	cache_t pmin{std::invoke(p, *left)};
+	cache_t pmax{pmin};
+
+	while(++left != right) {
+	    auto i{left};
+	    cache_t pi{std::invoke(p, *i)};
+
+	    if(++left == right) {
+		if(std::invoke(f, pi.get(), pmin.get()))
+		    min = i;
+		else if(!std::invoke(f, pi.get(), pmax.get()))
+		    max = i;
+		break;
+	    }
+
+	    cache_t pj{std::invoke(p, *left)};
+	    if(std::invoke(f, pj.get(), pi.get())) {
+		if(std::invoke(f, pj.get(), pmin.get()))
+		    min = left, pmin = std::move(pj);
+		if(!std::invoke(f, pi.get(), pmax.get()))
+		    max = i, pmax = std::move(pi);
+	    } else {
+		if(std::invoke(f, pi.get(), pmin.get()))
+		    min = i, pmin = std::move(pi);
+		if(!std::invoke(f, pj.get(), pmax.get()))
+		    max = left, pmax = std::move(pj);
+	    }
 	}
 
 	return {min, max};
@@ -192,7 +487,47 @@ namespace alg
 	return minmax_element(std::begin(range), std::end(range), std::ref(f), std::ref(p));
     }
 
-    
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter, std::sized_sentinel_for<Iter> Sent,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    [[nodiscard]] auto minmax_element(Policy&&, Iter left, Sent right, Comp f = {}, Proj p = {})
+	-> std::ranges::minmax_result<Iter>
+    {
+	const auto n{static_cast<std::size_t>(right - left)};
+	const auto chunks{concepts::parallel_execution_policy<Policy> ? detail::chunk_count(n) : 1};
+	if(chunks == 1)
+	    return ::alg::minmax_element(std::move(left), std::move(right), std::ref(f), std::ref(p));
+
+	auto found = detail::search_chunks(std::move(left), n, chunks, [&] (Iter l, Iter r) {
+	    return ::alg::minmax_element(std::move(l), std::move(r), std::ref(f), std::ref(p));
+	});
+
+	auto result{found[0]};
+	for(std::size_t i{1}; i != chunks; ++i) {
+	    if(std::invoke(f, std::invoke(p, *found[i].min), std::invoke(p, *result.min)))
+		result.min = found[i].min;
+	    if(!std::invoke(f, std::invoke(p, *found[i].max), std::invoke(p, *result.max)))
+		result.max = found[i].max;
+	}
+
+	return result;
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    requires std::ranges::sized_range<Range>
+    [[nodiscard]] auto minmax_element(Policy&& policy, Range&& range, Comp f = {}, Proj p = {})
+	-> std::ranges::minmax_result<std::ranges::borrowed_iterator_t<Range>>
+    {
+	return ::alg::minmax_element(std::forward<Policy>(policy), std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
     //******************* minmax **********************
 
     template<typename T,
@@ -232,6 +567,71 @@ namespace alg
     }
 
 
+    //*************** min_k_elements ****************
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	std::weakly_incrementable Out,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable_storable<Iter, std::iter_value_t<Iter>*> &&
+	std::indirectly_writable<Out, std::iter_value_t<Iter>&&>
+    constexpr auto min_k_elements(Iter left, Sent right, std::iter_difference_t<Iter> k, Out out,
+	    Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<Iter, Out>
+    {
+	return detail::best_k_elements(std::move(left), std::move(right), k, std::move(out), f, p);
+    }
+
+    template<std::ranges::input_range Range,
+	std::weakly_incrementable Out,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable_storable<std::ranges::iterator_t<Range>, std::ranges::range_value_t<Range>*> &&
+	std::indirectly_writable<Out, std::ranges::range_value_t<Range>&&>
+    constexpr auto min_k_elements(Range&& range, std::ranges::range_difference_t<Range> k, Out out,
+	    Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range>, Out>
+    {
+	return ::alg::min_k_elements(std::begin(range), std::end(range), std::move(k), std::move(out), std::ref(f), std::ref(p));
+    }
+
+
+    //*************** max_k_elements ****************
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	std::weakly_incrementable Out,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable_storable<Iter, std::iter_value_t<Iter>*> &&
+	std::indirectly_writable<Out, std::iter_value_t<Iter>&&>
+    constexpr auto max_k_elements(Iter left, Sent right, std::iter_difference_t<Iter> k, Out out,
+	    Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<Iter, Out>
+    {
+	auto greater = [&f] (auto&& a, auto&& b) -> bool {
+	    return std::invoke(f, std::forward<decltype(b)>(b), std::forward<decltype(a)>(a));
+	};
+	return detail::best_k_elements(std::move(left), std::move(right), k, std::move(out), greater, p);
+    }
+
+    template<std::ranges::input_range Range,
+	std::weakly_incrementable Out,
+	typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable_storable<std::ranges::iterator_t<Range>, std::ranges::range_value_t<Range>*> &&
+	std::indirectly_writable<Out, std::ranges::range_value_t<Range>&&>
+    constexpr auto max_k_elements(Range&& range, std::ranges::range_difference_t<Range> k, Out out,
+	    Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range>, Out>
+    {
+	return ::alg::max_k_elements(std::begin(range), std::end(range), std::move(k), std::move(out), std::ref(f), std::ref(p));
+    }
+
+
     //******************* clamp ***********************
 
     template<typename T, 
@@ -247,4 +647,94 @@ namespace alg
     }
 
 
+    //***************** clamp_range *******************
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>,
+	    std::projected<const T*, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_writable<Iter, const T&>
+    constexpr auto clamp_range(Iter left, Sent right, const T& l, const T& h, Comp f = {}, Proj p = {}) -> Iter
+    {
+	if constexpr(detail::clamp_vectorizable<Iter, Iter, T, Comp, Proj> && std::sized_sentinel_for<Sent, Iter>)
+	    if(!std::is_constant_evaluated()) {
+		const auto n{right - left};
+		detail::clamp_kernel(std::to_address(left), std::to_address(left), static_cast<std::size_t>(n), l, h);
+		return left + n;
+	    }
+
+	auto&& pl = std::invoke(p, l);
+	auto&& ph = std::invoke(p, h);
+
+	for(; left != right; ++left)
+	    if(std::invoke(f, std::invoke(p, *left), pl))
+		*left = l;
+	    else if(std::invoke(f, ph, std::invoke(p, *left)))
+		*left = h;
+
+	return left;
+    }
+
+    template<std::ranges::input_range Range,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>,
+	    std::projected<const T*, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_writable<std::ranges::iterator_t<Range>, const T&>
+    constexpr auto clamp_range(Range&& range, const T& l, const T& h, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::clamp_range(std::begin(range), std::end(range), l, h, std::ref(f), std::ref(p));
+    }
+
+
+    //*************** clamp_range_copy ****************
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	std::weakly_incrementable Out,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter, Proj>,
+	    std::projected<const T*, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable<Iter, Out> && std::indirectly_writable<Out, const T&>
+    constexpr auto clamp_range_copy(Iter left, Sent right, Out out, const T& l, const T& h, Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<Iter, Out>
+    {
+	if constexpr(detail::clamp_vectorizable<Iter, Out, T, Comp, Proj> && std::sized_sentinel_for<Sent, Iter>)
+	    if(!std::is_constant_evaluated()) {
+		const auto n{right - left};
+		detail::clamp_kernel(std::to_address(left), std::to_address(out), static_cast<std::size_t>(n), l, h);
+		return {left + n, out + n};
+	    }
+
+	auto&& pl = std::invoke(p, l);
+	auto&& ph = std::invoke(p, h);
+
+	for(; left != right; ++left, ++out)
+	    if(std::invoke(f, std::invoke(p, *left), pl))
+		*out = l;
+	    else if(std::invoke(f, ph, std::invoke(p, *left)))
+		*out = h;
+	    else
+		*out = *left;
+
+	return {std::move(left), std::move(out)};
+    }
+
+    template<std::ranges::input_range Range,
+	std::weakly_incrementable Out,
+	typename T, typename Proj = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range>, Proj>,
+	    std::projected<const T*, Proj>> Comp = std::ranges::less>
+    requires std::indirectly_copyable<std::ranges::iterator_t<Range>, Out> &&
+	std::indirectly_writable<Out, const T&>
+    constexpr auto clamp_range_copy(Range&& range, Out out, const T& l, const T& h, Comp f = {}, Proj p = {})
+	-> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range>, Out>
+    {
+	return ::alg::clamp_range_copy(std::begin(range), std::end(range), std::move(out), l, h, std::ref(f), std::ref(p));
+    }
+
+
 }
@@ -4,18 +4,97 @@
 #include <ranges>
 #include <iterator>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <span>
 
+#include "utility_concepts.hpp"
 #include "non_modifying_operations.hpp"
 #include "minmax_operations.hpp"
 
 namespace alg
 {
 
+    namespace detail
+    {
+
+	template<std::contiguous_iterator Iter, std::contiguous_iterator Out>
+	auto memmove_n(Iter left, std::iter_difference_t<Iter> n, Out out)
+	    -> std::ranges::in_out_result<Iter, Out>
+	{
+	    if(n > 0)
+		std::memmove(std::to_address(out), std::to_address(left), n * sizeof(std::iter_value_t<Iter>));
+
+	    return {left + n, out + n};
+	}
+
+	template<std::contiguous_iterator Iter, std::contiguous_iterator Out>
+	auto memmove_backwards_n(Iter left, std::iter_difference_t<Iter> n, Out out)
+	    -> std::ranges::in_out_result<Iter, Out>
+	{
+	    out -= n;
+	    if(n > 0)
+		std::memmove(std::to_address(out), std::to_address(left), n * sizeof(std::iter_value_t<Iter>));
+
+	    return {left + n, out};
+	}
+
+	inline constexpr std::size_t swap_block_size{256};
+
+	// Bytes moved per step of the crosswise swap, small enough for both
+	// sides to stay in registers
+	inline constexpr std::size_t swap_word_block{32};
+
+	template<std::contiguous_iterator Iter1, std::contiguous_iterator Iter2>
+	auto swap_bytes_n(Iter1 left1, Iter2 left2, std::iter_difference_t<Iter1> n)
+	    -> std::ranges::in_in_result<Iter1, Iter2>
+	{
+	    auto* a{reinterpret_cast<unsigned char*>(std::to_address(left1))};
+	    auto* b{reinterpret_cast<unsigned char*>(std::to_address(left2))};
+	    std::size_t bytes{n * sizeof(std::iter_value_t<Iter1>)};
+
+	    if constexpr(sizeof(std::iter_value_t<Iter1>) > swap_block_size) {
+		unsigned char buffer[swap_block_size];
+		while(bytes != 0) {
+		    const auto chunk{::alg::min(bytes, swap_block_size)};
+		    std::memcpy(buffer, a, chunk);
+		    std::memcpy(a, b, chunk);
+		    std::memcpy(b, buffer, chunk);
+		    a += chunk, b += chunk, bytes -= chunk;
+		}
+	    } else {
+		unsigned char x[swap_word_block], y[swap_word_block];
+		for(; bytes >= swap_word_block; a += swap_word_block, b += swap_word_block, bytes -= swap_word_block) {
+		    std::memcpy(x, a, swap_word_block);
+		    std::memcpy(y, b, swap_word_block);
+		    std::memcpy(a, y, swap_word_block);
+		    std::memcpy(b, x, swap_word_block);
+		}
+		std::memcpy(x, a, bytes);
+		std::memcpy(y, b, bytes);
+		std::memcpy(a, y, bytes);
+		std::memcpy(b, x, bytes);
+	    }
+
+	    return {left1 + n, left2 + n};
+	}
+
+    }
+
+
     //********************** iter_swap ****************************
     
     template<std::input_iterator Iter1, std::input_iterator Iter2>
     constexpr auto iter_swap(Iter1 it1, Iter2 it2)
     {
+	if constexpr(concepts::bitwise_copyable<Iter1, Iter2> &&
+		sizeof(std::iter_value_t<Iter1>) > detail::swap_block_size)
+	    if(!std::is_constant_evaluated()) {
+		if(std::to_address(it1) != std::to_address(it2))
+		    detail::swap_bytes_n(std::move(it1), std::move(it2), 1);
+		return;
+	    }
+
 	std::swap(*it1, *it2);
     }
 
@@ -183,6 +262,10 @@ namespace alg
     constexpr auto move(Iter left, Sent right, Out out)
 	-> std::ranges::in_out_result<Iter, Out>
     {
+	if constexpr(concepts::bitwise_copyable<Iter, Out> && std::sized_sentinel_for<Sent, Iter>)
+	    if(!std::is_constant_evaluated())
+		return detail::memmove_n(std::move(left), right - left, std::move(out));
+
 	for(; left != right; ++left, ++out)
 	    *out = std::ranges::iter_move(left);
 
@@ -207,6 +290,10 @@ namespace alg
     constexpr auto move_n(Iter left, std::iter_difference_t<Iter> n, Out out)
 	-> std::ranges::in_out_result<Iter, Out>
     {
+	if constexpr(concepts::bitwise_copyable<Iter, Out>)
+	    if(!std::is_constant_evaluated())
+		return detail::memmove_n(std::move(left), n, std::move(out));
+
 	for(std::iter_difference_t<Iter> i{}; i != n; ++left, ++out, ++i)
 	    *out = std::ranges::iter_move(left);
 
@@ -232,6 +319,11 @@ namespace alg
 	-> std::ranges::in_out_result<Iter, Out>
     {
 	Iter iter{std::ranges::next(left, std::move(right))};
+
+	if constexpr(concepts::bitwise_copyable<Iter, Out>)
+	    if(!std::is_constant_evaluated())
+		return {iter, detail::memmove_backwards_n(left, iter - left, std::move(out)).out};
+
 	for(Iter i{iter}; i != left; *--out = std::ranges::iter_move(--i));
 
 	return {std::move(iter), std::move(out)};
@@ -255,6 +347,10 @@ namespace alg
     constexpr auto move_backwards_n(Iter left, std::iter_difference_t<Iter> n, Out out)
 	-> std::ranges::in_out_result<Iter, Out>
     {
+	if constexpr(concepts::bitwise_copyable<Iter, Out>)
+	    if(!std::is_constant_evaluated())
+		return detail::memmove_backwards_n(std::move(left), n, std::move(out));
+
 	Iter iter{std::ranges::next(left, n)};
 	for(Iter i{iter}; i != left; *--out = std::ranges::iter_move(--i));
 
@@ -446,6 +542,13 @@ namespace alg
     requires std::invocable<F&> && std::indirectly_writable<Iter, std::invoke_result_t<F&>>
     constexpr auto generate(Iter left, Sent right, F gen)
     {
+	if constexpr(std::contiguous_iterator<Iter> && std::sized_sentinel_for<Sent, Iter> &&
+		concepts::span_generator<F, std::iter_value_t<Iter>>) {
+	    const auto n{right - left};
+	    gen.fill(std::span{std::to_address(left), static_cast<std::size_t>(n)});
+	    return left + n;
+	}
+
 	for(; left != right; *left++ = std::invoke(gen));
 	return left;
     }
@@ -466,6 +569,14 @@ namespace alg
     requires std::invocable<F&> && std::indirectly_writable<Iter, std::invoke_result_t<F&>>
     constexpr auto generate_n(Iter left, std::iter_difference_t<Iter> n, F gen)
     {
+	if constexpr(std::contiguous_iterator<Iter> &&
+		concepts::span_generator<F, std::iter_value_t<Iter>>) {
+	    if(n <= 0)
+		return left;
+	    gen.fill(std::span{std::to_address(left), static_cast<std::size_t>(n)});
+	    return left + n;
+	}
+
 	for(std::iter_difference_t<Iter> i{}; i < n; ++i, *left++ = std::invoke(gen));
 	return left;
     }
@@ -989,6 +1100,12 @@ namespace alg
     constexpr auto swap_ranges(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2)
 	-> std::ranges::in_in_result<Iter1, Iter2>
     {
+	if constexpr(concepts::bitwise_copyable<Iter1, Iter2> &&
+		std::sized_sentinel_for<Sent1, Iter1> && std::sized_sentinel_for<Sent2, Iter2>)
+	    if(!std::is_constant_evaluated())
+		return detail::swap_bytes_n(std::move(left1), std::move(left2),
+			::alg::min<std::iter_difference_t<Iter1>>(right1 - left1, right2 - left2));
+
 	for(; left1 != right1 && left2 != right2; ++left1, ++left2)
 	    ::alg::iter_swap(left1, left2);
 
@@ -1351,12 +1468,14 @@ namespace alg
     constexpr auto shift_left(Iter left, Sent right, std::iter_difference_t<Iter> n)
 	-> std::ranges::subrange<Iter> 
     {
-	if(n >= std::distance(left, right) || !n)
+	if(!n)
 	    return {left, left};
 
-	auto beginning{std::ranges::next(left, n)};
+	auto beginning{left};
+	if(std::ranges::advance(beginning, n, right) != 0 || beginning == right)
+	    return {left, left};
 
-	auto ret = ::alg::move(beginning, std::move(right), left);
+	auto ret = ::alg::move(std::move(beginning), std::move(right), left);
 
 	return {std::move(left), std::move(ret.out)};
     }
@@ -1391,13 +1510,30 @@ namespace alg
 	    auto ret = ::alg::move_backwards(std::move(left), std::move(ending), beginning);
 	    return {std::move(ret.out), std::move(right)};
 	} else { // forward_iterator<Iter>
-	    Iter middle{left};
-	    for(std::iter_difference_t<Iter> i{}; i != n && middle != right; ++i, ++middle);
-
-	    if(middle == right || ++middle == right)
-		return {std::move(left), std::move(middle)};
+	    auto result{std::ranges::next(left, n, right)};
+	    if(result == right)
+		return {result, result};
+
+	    auto dest_head{left}, dest_tail{result};
+	    for(; dest_head != result; ++dest_head, ++dest_tail)
+		if(dest_tail == right) {
+		    ::alg::move(std::move(left), std::move(dest_head), result);
+		    return {std::move(result), std::move(dest_tail)};
+		}
 
-	    return ::alg::rotate(std::move(left), std::move(middle), std::move(right)); 
+	    // [left, result) is a ring buffer holding the next n elements to be
+	    // written. Each step swaps the element due at dest_head with the one
+	    // it displaces, so every element costs three moves, but the range is
+	    // walked only once instead of rotated.
+	    for(;;)
+		for(auto cursor{left}; cursor != result; ++cursor, ++dest_head, ++dest_tail) {
+		    if(dest_tail == right) {
+			dest_head = ::alg::move(cursor, result, std::move(dest_head)).out;
+			::alg::move(left, std::move(cursor), std::move(dest_head));
+			return {std::move(result), std::move(dest_tail)};
+		    }
+		    ::alg::iter_swap(cursor, dest_head);
+		}
 	}
     }
 
@@ -4,12 +4,886 @@
 #include <functional>
 #include <iterator>
 #include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
 
+#include "utility_concepts.hpp"
 #include "modifying_operations.hpp"
+#include "binary_search_operations.hpp"
+#include "execution.hpp"
 
 namespace alg
 {
 
+    namespace detail
+    {
+
+	// Skew above which galloping beats a lockstep merge
+	inline constexpr std::size_t gallop_ratio{32};
+
+	// Output that only counts, lets the merge engines compute cardinalities
+	struct counting_sink
+	{
+	    std::size_t count{};
+	};
+
+	template<typename Out, typename T>
+	constexpr void emit(Out& out, T&& value)
+	{
+	    *out++ = std::forward<T>(value);
+	}
+
+	template<typename T>
+	constexpr void emit(counting_sink& out, T&&)
+	{
+	    ++out.count;
+	}
+
+	// Rvalue containers handed to an algorithm are never looked at again, so
+	// their elements may be moved into the output instead of copied. The
+	// engines still compare through plain references and only move at the
+	// write, so comparators and projections never see a moved-from element.
+	template<typename Range>
+	concept owning_rvalue_range = !std::is_lvalue_reference_v<Range> &&
+	    !std::ranges::borrowed_range<Range> &&
+	    !std::ranges::view<std::remove_cvref_t<Range>>;
+
+	template<typename Range>
+	concept consumable_range = owning_rvalue_range<Range> &&
+	    !std::is_trivially_copyable_v<std::ranges::range_value_t<Range>>;
+
+	template<bool Consume, typename Iter>
+	constexpr auto take(const Iter& it) -> decltype(auto)
+	{
+	    if constexpr(Consume)
+		return std::ranges::iter_move(it);
+	    else
+		return *it;
+	}
+
+	template<bool Consume, typename Iter, typename Sent, typename Out>
+	constexpr auto transfer(Iter left, Sent right, Out out) -> std::ranges::in_out_result<Iter, Out>
+	{
+	    if constexpr(Consume)
+		return ::alg::move(std::move(left), std::move(right), std::move(out));
+	    else
+		return ::alg::copy(std::move(left), std::move(right), std::move(out));
+	}
+
+	template<typename Iter1, typename Sent1, typename Iter2, typename Sent2>
+	concept gallopable = 
+	    std::random_access_iterator<Iter1> && std::sized_sentinel_for<Sent1, Iter1> &&
+	    std::random_access_iterator<Iter2> && std::sized_sentinel_for<Sent2, Iter2>;
+
+	// Intersection for inputs of very different sizes, each element of the smaller
+	// input is located in the larger one by galloping from the last match
+	template<bool Consume1, typename Iter1, typename Iter2, typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto gallop_intersection(Iter1 left1, Iter1 right1, Iter2 left2, Iter2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> Out
+	{
+	    if(right1 - left1 <= right2 - left2)
+		for(; left1 != right1; ++left1) {
+		    left2 = gallop(left2, right2, [&] (auto&& e2) {
+			return std::invoke(f, std::invoke(p2, e2), std::invoke(p1, *left1));
+		    });
+		    if(left2 == right2)
+			break;
+		    if(!std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))) {
+			emit(out, take<Consume1>(left1));
+			++left2;
+		    }
+		}
+	    else
+		for(; left2 != right2; ++left2) {
+		    left1 = gallop(left1, right1, [&] (auto&& e1) {
+			return std::invoke(f, std::invoke(p1, e1), std::invoke(p2, *left2));
+		    });
+		    if(left1 == right1)
+			break;
+		    if(!std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1))) {
+			emit(out, take<Consume1>(left1));
+			++left1;
+		    }
+		}
+
+	    return out;
+	}
+
+	template<typename Diff1, typename Diff2>
+	constexpr auto skewed(Diff1 n1, Diff2 n2) -> bool
+	{
+	    const auto a{static_cast<std::size_t>(n1)}, b{static_cast<std::size_t>(n2)};
+	    return a * gallop_ratio < b || b * gallop_ratio < a;
+	}
+
+
+	template<typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Comp, typename Proj1, typename Proj2>
+	concept integer_intersectable = 
+	    std::contiguous_iterator<Iter1> && std::sized_sentinel_for<Sent1, Iter1> &&
+	    std::contiguous_iterator<Iter2> && std::sized_sentinel_for<Sent2, Iter2> &&
+	    std::same_as<std::iter_value_t<Iter1>, std::iter_value_t<Iter2>> &&
+	    std::integral<std::iter_value_t<Iter1>> &&
+	    concepts::default_less<Comp> &&
+	    concepts::identity_projection<Proj1> &&
+	    concepts::identity_projection<Proj2>;
+
+	inline constexpr std::size_t intersection_block{8};
+
+	// Lockstep merge without data-dependent branches: matches are staged in a
+	// small buffer unconditionally and kept by advancing the fill index
+	template<typename T, typename Out>
+	auto branchless_intersection(const T* a, std::size_t n1, const T* b, std::size_t n2, Out out) -> Out
+	{
+	    constexpr std::size_t buffer_size{64};
+	    T buffer[buffer_size];
+	    std::size_t i{}, j{}, k{};
+
+	    while(i < n1 && j < n2) {
+		const T x{a[i]}, y{b[j]};
+		if constexpr(std::same_as<Out, counting_sink>)
+		    out.count += x == y;
+		else {
+		    buffer[k] = x;
+		    k += x == y;
+		    if(k == buffer_size) {
+			out = ::alg::copy(buffer, buffer + k, std::move(out)).out;
+			k = 0;
+		    }
+		}
+		i += x <= y;
+		j += y <= x;
+	    }
+
+	    if constexpr(std::same_as<Out, counting_sink>)
+		return out;
+	    else
+		return ::alg::copy(buffer, buffer + k, std::move(out)).out;
+	}
+
+	// Checks that [first, first + block] increases strictly, so the block
+	// holds distinct values none of which shows up again further on
+	template<typename T>
+	auto strict_block(const T* first) -> bool
+	{
+	    bool strict{true};
+	    for(std::size_t t{}; t != intersection_block; ++t)
+		strict &= first[t] < first[t + 1];
+	    return strict;
+	}
+
+	// Compares a block of each input all against all in fixed-width loops
+	// the compiler turns into vector compares, keeps the values of a that
+	// found a partner and moves on past whichever block ends lower. Pairing
+	// whole blocks is only sound for distinct values, so once a block holds
+	// a duplicate the rest past the values already settled is left to the
+	// lockstep merge.
+	template<typename T, typename Out>
+	auto block_intersection(const T* a, std::size_t n1, const T* b, std::size_t n2, Out out) -> Out
+	{
+	    constexpr auto block{intersection_block};
+	    std::size_t i{}, j{};
+	    bool started{};
+	    T settled{};
+
+	    while(i + block < n1 && j + block < n2 && strict_block(a + i) && strict_block(b + j)) {
+		bool found[block]{};
+		for(std::size_t u{}; u != block; ++u)
+		    for(std::size_t t{}; t != block; ++t)
+			found[t] |= a[i + t] == b[j + u];
+
+		if constexpr(std::same_as<Out, counting_sink>)
+		    for(std::size_t t{}; t != block; ++t)
+			out.count += found[t];
+		else {
+		    T kept[block];
+		    std::size_t k{};
+		    for(std::size_t t{}; t != block; ++t) {
+			kept[k] = a[i + t];
+			k += found[t];
+		    }
+		    out = ::alg::copy(kept, kept + k, std::move(out)).out;
+		}
+
+		const T last1{a[i + block - 1]}, last2{b[j + block - 1]};
+		settled = last1 < last2 ? last1 : last2;
+		started = true;
+		i += last1 <= last2 ? block : 0;
+		j += last2 <= last1 ? block : 0;
+	    }
+
+	    if(started) {
+		for(; i != n1 && a[i] <= settled; ++i);
+		for(; j != n2 && b[j] <= settled; ++j);
+	    }
+	    return branchless_intersection(a + i, n1 - i, b + j, n2 - j, std::move(out));
+	}
+
+	// Gallops over whole blocks of the larger input, then locates each value
+	// inside its block with a fixed-width compare-and-count
+	template<typename T, typename Out>
+	auto block_gallop_intersection(const T* small, std::size_t ns, const T* large, std::size_t nl, Out out) -> Out
+	{
+	    constexpr auto block{intersection_block};
+	    std::size_t j{};
+
+	    for(std::size_t i{}; i != ns; ++i) {
+		const T x{small[i]};
+
+		std::size_t low{j}, step{block};
+		for(; j + step <= nl && large[j + step - 1] < x; step *= 2)
+		    low = j + step;
+		auto high{j + step < nl ? j + step : nl};
+
+		while(high - low > block) {
+		    const auto mid{low + (high - low) / 2};
+		    if(large[mid] < x)
+			low = mid + 1;
+		    else
+			high = mid;
+		}
+
+		std::size_t below{};
+		if(low + block <= nl)
+		    for(std::size_t t{}; t != block; ++t)
+			below += large[low + t] < x;
+		else
+		    for(std::size_t t{low}; t != nl; ++t)
+			below += large[t] < x;
+
+		j = low + below;
+		if(j == nl)
+		    break;
+		if(large[j] == x) {
+		    emit(out, x);
+		    ++j;
+		}
+	    }
+
+	    return out;
+	}
+
+	// Iterator over a sequence of sorted runs whose elements outlive the run objects
+	template<typename Iter>
+	concept run_iterator = std::input_iterator<Iter> &&
+	    std::ranges::input_range<std::iter_reference_t<Iter>> &&
+	    (std::is_lvalue_reference_v<std::iter_reference_t<Iter>> ||
+	     std::ranges::borrowed_range<std::iter_reference_t<Iter>>);
+
+	template<typename Iter>
+	using run_element_iterator_t = std::ranges::iterator_t<std::iter_reference_t<Iter>>;
+
+	// Tournament over k runs keeping the loser of every match in the inner
+	// nodes, so replacing the winner replays a single leaf-to-root path.
+	// Ties go to the lower run index, which keeps the merge stable.
+	template<typename Iter, typename Sent, typename Comp, typename Proj>
+	class loser_tree
+	{
+	public:
+	    template<typename RunIter, typename RunSent>
+	    constexpr loser_tree(RunIter left, RunSent right, Comp& f, Proj& p) : f{f}, p{p}
+	    {
+		for(; left != right; ++left)
+		    runs.push_back({std::ranges::begin(*left), std::ranges::end(*left)});
+
+		const auto k{std::size(runs)};
+		tree.assign(k ? k : 1, none);
+		for(auto i{k}; i-- != 0;)
+		    replay(i);
+	    }
+
+	    [[nodiscard]] constexpr auto empty() const -> bool
+	    {
+		return std::empty(runs) || exhausted(tree[0]);
+	    }
+
+	    [[nodiscard]] constexpr auto size() const -> std::size_t
+	    {
+		return std::size(runs);
+	    }
+
+	    [[nodiscard]] constexpr auto top() const -> std::size_t
+	    {
+		return tree[0];
+	    }
+
+	    [[nodiscard]] constexpr auto current(std::size_t run) const -> const Iter&
+	    {
+		return runs[run].first;
+	    }
+
+	    constexpr void pop()
+	    {
+		const auto run{tree[0]};
+		++runs[run].first;
+		replay(run);
+	    }
+
+	private:
+	    static constexpr auto none{static_cast<std::size_t>(-1)};
+
+	    [[nodiscard]] constexpr auto exhausted(std::size_t run) const -> bool
+	    {
+		return runs[run].first == runs[run].second;
+	    }
+
+	    [[nodiscard]] constexpr auto before(std::size_t a, std::size_t b) const -> bool
+	    {
+		if(exhausted(a))
+		    return false;
+		if(exhausted(b))
+		    return true;
+		if(std::invoke(f, std::invoke(p, *runs[a].first), std::invoke(p, *runs[b].first)))
+		    return true;
+		if(std::invoke(f, std::invoke(p, *runs[b].first), std::invoke(p, *runs[a].first)))
+		    return false;
+		return a < b;
+	    }
+
+	    // While the tree is being built an empty node parks the first
+	    // arrival, which is always the finished winner of one subtree
+	    constexpr void replay(std::size_t run)
+	    {
+		auto winner{run};
+		for(auto node{(run + std::size(runs)) / 2}; node != 0; node /= 2) {
+		    if(tree[node] == none) {
+			tree[node] = winner;
+			return;
+		    }
+		    if(before(tree[node], winner))
+			std::swap(tree[node], winner);
+		}
+		tree[0] = winner;
+	    }
+
+	    std::vector<std::pair<Iter, Sent>> runs;
+	    std::vector<std::size_t> tree;
+	    Comp& f;
+	    Proj& p;
+	};
+
+	template<typename RunIter, typename RunSent, typename Comp, typename Proj>
+	loser_tree(RunIter, RunSent, Comp&, Proj&) -> loser_tree<
+	    run_element_iterator_t<RunIter>,
+	    std::ranges::sentinel_t<std::iter_reference_t<RunIter>>,
+	    Comp, Proj>;
+
+	template<bool Consume, typename Iter, typename Sent, typename Out, typename Comp, typename Proj>
+	constexpr auto merge_runs(Iter left, Sent right, Out out, Comp& f, Proj& p) -> Out
+	{
+	    loser_tree runs{std::move(left), std::move(right), f, p};
+	    for(; !runs.empty(); runs.pop())
+		*out++ = take<Consume>(runs.current(runs.top()));
+	    return out;
+	}
+
+	// A group of equivalent values ends when the next winner orders after
+	// it. That is checked before the element is written, so a consumed
+	// element is never compared after it was moved from.
+	template<bool Consume, typename Iter, typename Sent, typename Out, typename Comp, typename Proj>
+	constexpr auto union_runs(Iter left, Sent right, Out out, Comp& f, Proj& p) -> Out
+	{
+	    loser_tree runs{std::move(left), std::move(right), f, p};
+
+	    std::vector<std::size_t> counts(runs.size()), touched;
+	    std::size_t group_max{};
+	    while(!runs.empty()) {
+		const auto run{runs.top()};
+		const auto it{runs.current(run)};
+
+		if(counts[run]++ == 0)
+		    touched.push_back(run);
+		const bool emitted{counts[run] > group_max};
+		if(emitted)
+		    ++group_max;
+
+		runs.pop();
+		const bool group_end{runs.empty() ||
+		    std::invoke(f, std::invoke(p, *it), std::invoke(p, *runs.current(runs.top())))};
+
+		if(emitted)
+		    *out++ = take<Consume>(it);
+		if(group_end) {
+		    for(auto t : touched)
+			counts[t] = 0;
+		    touched.clear();
+		    group_max = 0;
+		}
+	    }
+	    return out;
+	}
+
+	template<typename Range>
+	concept consumable_runs = owning_rvalue_range<Range> &&
+	    !std::is_trivially_copyable_v<std::iter_value_t<run_element_iterator_t<std::ranges::iterator_t<Range>>>>;
+
+	template<typename T, typename Out>
+	auto integer_intersection(const T* a, std::size_t n1, const T* b, std::size_t n2, Out out) -> Out
+	{
+	    if(n1 * gallop_ratio < n2)
+		return block_gallop_intersection(a, n1, b, n2, std::move(out));
+	    if(n2 * gallop_ratio < n1)
+		return block_gallop_intersection(b, n2, a, n1, std::move(out));
+	    return block_intersection(a, n1, b, n2, std::move(out));
+	}
+
+	// Default ordering over projections that also have <=>, which settles
+	// every step of a merge with one comparison instead of two
+	template<typename Comp, typename Iter1, typename Proj1, typename Iter2, typename Proj2>
+	concept three_way_default_less = concepts::default_less<Comp> &&
+	    std::three_way_comparable_with<
+		std::indirect_result_t<Proj1&, Iter1>,
+		std::indirect_result_t<Proj2&, Iter2>>;
+
+	// Lockstep engines driven by a three-way comparator. Unordered results
+	// count as equivalent, the same way two false calls of a less would.
+	template<typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Comp, typename Proj1, typename Proj2>
+	constexpr auto includes_three_way(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Comp& f, Proj1& p1, Proj2& p2) -> bool
+	{
+	    if constexpr(std::random_access_iterator<Iter1> && std::sized_sentinel_for<Sent1, Iter1>) {
+		const auto last1{left1 + (right1 - left1)};
+		for(; left2 != right2; ++left2, ++left1) {
+		    left1 = gallop(left1, last1, [&] (auto&& e1) {
+			return std::invoke(f, std::invoke(p1, e1), std::invoke(p2, *left2)) < 0;
+		    });
+		    if(left1 == last1 || std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)) > 0)
+			return false;
+		}
+		return true;
+	    }
+
+	    for(; left2 != right2; ++left1) {
+		if(left1 == right1)
+		    return false;
+		const auto c{std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))};
+		if(c > 0)
+		    return false;
+		if(!(c < 0))
+		    ++left2;
+	    }
+	    return true;
+	}
+
+	template<bool Consume1, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_difference_three_way(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_out_result<Iter1, Out>
+	{
+	    while(left1 != right1 && left2 != right2) {
+		const auto c{std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))};
+		if(c < 0) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(c > 0)
+		    ++left2;
+		else
+		    ++left1, ++left2;
+	    }
+	    return transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	}
+
+	template<bool Consume1, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_intersection_three_way(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    while(left1 != right1 && left2 != right2) {
+		const auto c{std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))};
+		if(c < 0)
+		    ++left1;
+		else if(c > 0)
+		    ++left2;
+		else {
+		    *out++ = take<Consume1>(left1);
+		    ++left1, ++left2;
+		}
+	    }
+	    return {std::ranges::next(std::move(left1), std::move(right1)),
+		    std::ranges::next(std::move(left2), std::move(right2)),
+		    std::move(out)};
+	}
+
+	template<bool Consume1, bool Consume2, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_union_three_way(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    while(left1 != right1 && left2 != right2) {
+		const auto c{std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))};
+		if(c < 0) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(c > 0) {
+		    *out++ = take<Consume2>(left2);
+		    ++left2;
+		}
+		else {
+		    *out++ = take<Consume1>(left1);
+		    ++left1, ++left2;
+		}
+	    }
+	    auto res1 = transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	    auto res2 = transfer<Consume2>(std::move(left2), std::move(right2), std::move(res1.out));
+	    return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	}
+
+	template<bool Consume1, bool Consume2, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_symmetric_difference_three_way(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    while(left1 != right1 && left2 != right2) {
+		const auto c{std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))};
+		if(c < 0) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(c > 0) {
+		    *out++ = take<Consume2>(left2);
+		    ++left2;
+		}
+		else {
+		    ++left1;
+		    ++left2;
+		}
+	    }
+	    auto res1 = transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	    auto res2 = transfer<Consume2>(std::move(left2), std::move(right2), std::move(res1.out));
+	    return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	}
+
+	// Output iterator that discards its writes and counts them, used to size
+	// the chunks of the parallel set operations
+	struct counting_iterator
+	{
+	    struct discard
+	    {
+		constexpr auto operator=(auto&&) const -> const discard& { return *this; }
+	    };
+
+	    using difference_type = std::ptrdiff_t;
+
+	    constexpr auto operator*() const -> discard { return {}; }
+	    constexpr auto operator++() -> counting_iterator& { ++count; return *this; }
+	    constexpr auto operator++(int) -> counting_iterator { auto old{*this}; ++count; return old; }
+
+	    std::size_t count{};
+	};
+
+	// Splits the merge of two sorted ranges into chunks of about equal
+	// length. Every cut is found on a merge-path diagonal and then moved back
+	// to the lower bound of its key in both inputs, so no group of
+	// equivalent elements straddles two chunks.
+	template<typename Iter1, typename Iter2, typename Comp, typename Proj1, typename Proj2>
+	auto merge_path_splits(Iter1 left1, std::size_t n1, Iter2 left2, std::size_t n2,
+		std::size_t chunks, Comp& f, Proj1& p1, Proj2& p2)
+	    -> std::vector<std::pair<std::size_t, std::size_t>>
+	{
+	    const auto at1 = [&] (std::size_t i) -> decltype(auto) { return std::invoke(p1, left1[static_cast<std::iter_difference_t<Iter1>>(i)]); };
+	    const auto at2 = [&] (std::size_t j) -> decltype(auto) { return std::invoke(p2, left2[static_cast<std::iter_difference_t<Iter2>>(j)]); };
+
+	    const auto lower_bounds = [&] (const auto& key) -> std::pair<std::size_t, std::size_t> {
+		std::size_t i{}, j{};
+		for(auto hi{n1}; i < hi;) {
+		    const auto mid{i + (hi - i) / 2};
+		    if(std::invoke(f, at1(mid), key))
+			i = mid + 1;
+		    else
+			hi = mid;
+		}
+		for(auto hi{n2}; j < hi;) {
+		    const auto mid{j + (hi - j) / 2};
+		    if(std::invoke(f, at2(mid), key))
+			j = mid + 1;
+		    else
+			hi = mid;
+		}
+		return {i, j};
+	    };
+
+	    std::vector<std::pair<std::size_t, std::size_t>> splits(chunks + 1);
+	    splits[chunks] = {n1, n2};
+	    for(std::size_t c{1}; c != chunks; ++c) {
+		const auto d{(n1 + n2) * c / chunks};
+
+		auto low{d > n2 ? d - n2 : 0}, high{std::min(d, n1)};
+		while(low < high) {
+		    const auto mid{low + (high - low) / 2};
+		    if(!std::invoke(f, at2(d - mid - 1), at1(mid)))
+			low = mid + 1;
+		    else
+			high = mid;
+		}
+
+		const auto i{low}, j{d - low};
+		if(i != n1 && (j == n2 || !std::invoke(f, at2(j), at1(i))))
+		    splits[c] = lower_bounds(at1(i));
+		else if(j != n2)
+		    splits[c] = lower_bounds(at2(j));
+		else
+		    splits[c] = {n1, n2};
+	    }
+	    return splits;
+	}
+
+	// Runs a sequential set operation on every merge-path chunk twice: once
+	// to count its output and once to write it at its exclusive-scan offset
+	template<typename Iter1, typename Iter2, typename Out, typename Comp, typename Proj1, typename Proj2, typename Op>
+	auto parallel_set_operation(Iter1 left1, std::size_t n1, Iter2 left2, std::size_t n2, Out out,
+		std::size_t chunks, Comp& f, Proj1& p1, Proj2& p2, Op op) -> Out
+	{
+	    using diff1_t = std::iter_difference_t<Iter1>;
+	    using diff2_t = std::iter_difference_t<Iter2>;
+	    using out_diff_t = std::iter_difference_t<Out>;
+
+	    const auto splits{merge_path_splits(left1, n1, left2, n2, chunks, f, p1, p2)};
+	    const auto run = [&] (std::size_t c, auto o) {
+		const auto [i1, j1]{splits[c]};
+		const auto [i2, j2]{splits[c + 1]};
+		return std::invoke(op, left1 + static_cast<diff1_t>(i1), left1 + static_cast<diff1_t>(i2),
+			left2 + static_cast<diff2_t>(j1), left2 + static_cast<diff2_t>(j2), std::move(o));
+	    };
+
+	    std::vector<std::size_t> offsets(chunks + 1);
+	    thread_pool::instance().run(chunks, [&] (std::size_t c) {
+		offsets[c + 1] = run(c, counting_iterator{}).count;
+	    });
+	    for(std::size_t c{}; c != chunks; ++c)
+		offsets[c + 1] += offsets[c];
+
+	    thread_pool::instance().run(chunks, [&] (std::size_t c) {
+		run(c, out + static_cast<out_diff_t>(offsets[c]));
+	    });
+	    return out + static_cast<out_diff_t>(offsets[chunks]);
+	}
+
+	// Splits a set operation into merge-path chunks when the policy is
+	// parallel and the inputs are large enough, otherwise runs it whole
+	template<typename Policy, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2, typename Op>
+	auto partitioned_set_operation(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2, Op op) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    const auto n1{static_cast<std::size_t>(right1 - left1)};
+	    const auto n2{static_cast<std::size_t>(right2 - left2)};
+	    const auto last1{left1 + (right1 - left1)};
+	    const auto last2{left2 + (right2 - left2)};
+
+	    const auto chunks{concepts::parallel_execution_policy<Policy> ? chunk_count(n1 + n2) : 1};
+	    if(chunks == 1)
+		out = std::invoke(op, left1, last1, left2, last2, std::move(out));
+	    else
+		out = parallel_set_operation(left1, n1, left2, n2, std::move(out), chunks, f, p1, p2, op);
+	    return {last1, last2, std::move(out)};
+	}
+
+	// Sequential engines behind the public overloads. ConsumeN moves the
+	// elements of the Nth input into the output at the write.
+	template<bool Consume1, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_difference_merge(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_out_result<Iter1, Out>
+	{
+	    if constexpr(three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+		std::compare_three_way cmp;
+		return set_difference_three_way<Consume1>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		    std::move(out), cmp, p1, p2);
+	    }
+
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		    ++left2;
+		else
+		    ++left1, ++left2;
+	    }
+	    return transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	}
+
+	template<bool Consume1, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_intersection_merge(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    if constexpr(integer_intersectable<Iter1, Sent1, Iter2, Sent2, Comp, Proj1, Proj2>)
+		if(!std::is_constant_evaluated()) {
+		    const auto n1{right1 - left1};
+		    const auto n2{right2 - left2};
+		    out = integer_intersection(std::to_address(left1), static_cast<std::size_t>(n1),
+			    std::to_address(left2), static_cast<std::size_t>(n2), std::move(out));
+		    return {left1 + n1, left2 + n2, std::move(out)};
+		}
+
+	    if constexpr(gallopable<Iter1, Sent1, Iter2, Sent2>) {
+		const auto n1{right1 - left1};
+		const auto n2{right2 - left2};
+		if(skewed(n1, n2)) {
+		    out = gallop_intersection<Consume1>(left1, left1 + n1, left2, left2 + n2, std::move(out), f, p1, p2);
+		    return {left1 + n1, left2 + n2, std::move(out)};
+		}
+	    }
+
+	    if constexpr(three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+		std::compare_three_way cmp;
+		return set_intersection_three_way<Consume1>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		    std::move(out), cmp, p1, p2);
+	    }
+
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
+		    ++left1;
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		    ++left2;
+		else {
+		    *out++ = take<Consume1>(left1);
+		    ++left1, ++left2;
+		}
+	    }
+	    return {std::ranges::next(std::move(left1), std::move(right1)),
+		    std::ranges::next(std::move(left2), std::move(right2)),
+		    std::move(out)};
+	}
+
+	template<bool Consume1, bool Consume2, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_union_merge(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    if constexpr(three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+		std::compare_three_way cmp;
+		return set_union_three_way<Consume1, Consume2>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		    std::move(out), cmp, p1, p2);
+	    }
+
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1))) {
+		    *out++ = take<Consume2>(left2);
+		    ++left2;
+		}
+		else {
+		    *out++ = take<Consume1>(left1);
+		    ++left1, ++left2;
+		}
+	    }
+	    auto res1 = transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	    auto res2 = transfer<Consume2>(std::move(left2), std::move(right2), std::move(res1.out));
+	    return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	}
+
+	template<bool Consume1, bool Consume2, typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Out, typename Comp, typename Proj1, typename Proj2>
+	constexpr auto set_symmetric_difference_merge(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Out out, Comp& f, Proj1& p1, Proj2& p2) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+	{
+	    if constexpr(three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+		std::compare_three_way cmp;
+		return set_symmetric_difference_three_way<Consume1, Consume2>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		    std::move(out), cmp, p1, p2);
+	    }
+
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))) {
+		    *out++ = take<Consume1>(left1);
+		    ++left1;
+		}
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1))) {
+		    *out++ = take<Consume2>(left2);
+		    ++left2;
+		}
+		else {
+		    ++left1;
+		    ++left2;
+		}
+	    }
+	    auto res1 = transfer<Consume1>(std::move(left1), std::move(right1), std::move(out));
+	    auto res2 = transfer<Consume2>(std::move(left2), std::move(right2), std::move(res1.out));
+	    return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	}
+
+
+	template<typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Comp, typename Proj1, typename Proj2>
+	constexpr auto intersection_size(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Comp& f, Proj1& p1, Proj2& p2) -> std::size_t
+	{
+	    if constexpr(integer_intersectable<Iter1, Sent1, Iter2, Sent2, Comp, Proj1, Proj2>)
+		if(!std::is_constant_evaluated())
+		    return integer_intersection(std::to_address(left1), static_cast<std::size_t>(right1 - left1),
+			    std::to_address(left2), static_cast<std::size_t>(right2 - left2), counting_sink{}).count;
+
+	    if constexpr(gallopable<Iter1, Sent1, Iter2, Sent2>) {
+		const auto n1{right1 - left1};
+		const auto n2{right2 - left2};
+		if(skewed(n1, n2))
+		    return gallop_intersection<false>(left1, left1 + n1, left2, left2 + n2,
+			    counting_sink{}, f, p1, p2).count;
+	    }
+
+	    if constexpr(three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+		std::compare_three_way cmp;
+		return set_intersection_three_way<false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		    counting_iterator{}, cmp, p1, p2).out.count;
+	    }
+
+	    std::size_t count{};
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
+		    ++left1;
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		    ++left2;
+		else
+		    ++count, ++left1, ++left2;
+	    }
+	    return count;
+	}
+
+	struct set_sizes
+	{
+	    std::size_t size1, size2, common;
+	};
+
+	// Input sizes together with the size of their intersection, which is all
+	// the other cardinalities are derived from
+	template<typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+	    typename Comp, typename Proj1, typename Proj2>
+	constexpr auto intersection_sizes(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+		Comp& f, Proj1& p1, Proj2& p2) -> set_sizes
+	{
+	    if constexpr(std::sized_sentinel_for<Sent1, Iter1> && std::sized_sentinel_for<Sent2, Iter2>) {
+		const auto n1{static_cast<std::size_t>(right1 - left1)};
+		const auto n2{static_cast<std::size_t>(right2 - left2)};
+		return {n1, n2, intersection_size(std::move(left1), std::move(right1), std::move(left2), std::move(right2), f, p1, p2)};
+	    }
+
+	    set_sizes sizes{};
+	    while(left1 != right1 && left2 != right2) {
+		if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
+		    ++left1, ++sizes.size1;
+		else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		    ++left2, ++sizes.size2;
+		else
+		    ++left1, ++left2, ++sizes.size1, ++sizes.size2, ++sizes.common;
+	    }
+	    sizes.size1 += static_cast<std::size_t>(std::ranges::distance(std::move(left1), std::move(right1)));
+	    sizes.size2 += static_cast<std::size_t>(std::ranges::distance(std::move(left2), std::move(right2)));
+	    return sizes;
+	}
+
+    }
+
     //****************** includes *********************
 
     template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
@@ -21,6 +895,26 @@ namespace alg
     [[nodiscard]] constexpr auto includes(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
 	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {})
     {
+	if constexpr(detail::three_way_default_less<Comp, Iter1, Proj1, Iter2, Proj2>) {
+	    std::compare_three_way cmp;
+	    return detail::includes_three_way(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		cmp, p1, p2);
+	}
+
+	// Each needle is searched from the previous match, so sparse needles
+	// cost a logarithm of the gap instead of the gap itself
+	if constexpr(std::random_access_iterator<Iter1> && std::sized_sentinel_for<Sent1, Iter1>) {
+	    const auto last1{left1 + (right1 - left1)};
+	    for(; left2 != right2; ++left2, ++left1) {
+		left1 = detail::gallop(left1, last1, [&] (auto&& e1) {
+		    return std::invoke(f, std::invoke(p1, e1), std::invoke(p2, *left2));
+		});
+		if(left1 == last1 || std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		    return false;
+	    }
+	    return true;
+	}
+
 	for (; left2 != right2; ++left1) {
 	    if (left1 == right1 || std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
 		return false;
@@ -45,6 +939,33 @@ namespace alg
     }
 
 
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Comp, typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<Iter1, Iter2, Comp, Proj1, Proj2>
+    [[nodiscard]] constexpr auto includes(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> bool
+    {
+	return detail::includes_three_way(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+		f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Comp, typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Comp, Proj1, Proj2>
+    [[nodiscard]] constexpr auto includes(Range1&& range1, Range2&& range2,
+	    Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> bool
+    {
+	return ::alg::includes(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
     //**************** set_diffrence *******************
     
     template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
@@ -55,15 +976,8 @@ namespace alg
     constexpr auto set_difference(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
 	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<Iter1, Out>
     {
-	while(left1 != right1 && left2 != right2) {
-	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
-		*out++ = *left1++;
-	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
-		++left2;
-	    else
-		++left1, ++left2;
-	}
-	return ::alg::copy(std::move(left1), std::move(right1), std::move(out));
+	return detail::set_difference_merge<false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
     }
 
 
@@ -78,78 +992,95 @@ namespace alg
     constexpr auto set_difference(Range1&& range1, Range2&& range2,
 	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range1>, Out>
     {
-	return ::alg::set_difference(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
-	    std::move(out), std::move(f), std::move(p1), std::move(p2));
+	return detail::set_difference_merge<detail::consumable_range<Range1>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
     }
 
 
-    //************* set_intersection ********************
-    
     template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
 	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
-	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	std::weakly_incrementable Out, typename Comp,
 	typename Proj1 = std::identity, typename Proj2 = std::identity>
-    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
-    constexpr auto set_intersection(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
-	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    requires concepts::indirectly_comparable_three_way<Iter1, Iter2, Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<Iter1, Out> && std::indirectly_copyable<Iter2, Out>
+    constexpr auto set_difference(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<Iter1, Out>
     {
-	while(left1 != right1 && left2 != right2) {
-	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
-		++left1;
-	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
-		++left2;
-	    else {
-		*out++ = *left1++;
-		++left2;
-	    }
-	}
-	return {std::ranges::next(std::move(left1), std::move(right1)),
-		std::ranges::next(std::move(left2), std::move(right2)),
-		std::move(out)};
+	return detail::set_difference_three_way<false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
     }
 
     template<std::ranges::input_range Range1,
 	std::ranges::input_range Range2,
-	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	std::weakly_incrementable Out, typename Comp,
 	typename Proj1 = std::identity, typename Proj2 = std::identity>
-    requires std::mergeable<
+    requires concepts::indirectly_comparable_three_way<
 	std::ranges::iterator_t<Range1>,
 	std::ranges::iterator_t<Range2>,
-	Out, Comp, Proj1, Proj2>
-    constexpr auto set_intersection(Range1&& range1, Range2&& range2,
-	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
-	    std::ranges::borrowed_iterator_t<Range1>, 
-	    std::ranges::borrowed_iterator_t<Range2>, 
-	    Out>
+	Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range1>, Out> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range2>, Out>
+    constexpr auto set_difference(Range1&& range1, Range2&& range2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range1>, Out>
     {
-	return ::alg::set_intersection(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
-	    std::move(out), std::move(f), std::move(p1), std::move(p2));
+	return detail::set_difference_three_way<detail::consumable_range<Range1>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
     }
 
 
-    //****************** set_union *********************
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter1, std::sized_sentinel_for<Iter1> Sent1,
+	std::random_access_iterator Iter2, std::sized_sentinel_for<Iter2> Sent2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    auto set_difference(Policy&&, Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<Iter1, Out>
+    {
+	auto res{detail::partitioned_set_operation<Policy>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2,
+	    [&] (Iter1 l1, Iter1 r1, Iter2 l2, Iter2 r2, auto o) {
+		return detail::set_difference_merge<false>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    })};
+	return {std::move(res.in1), std::move(res.out)};
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range1,
+	std::ranges::random_access_range Range2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::ranges::sized_range<Range1> && std::ranges::sized_range<Range2> &&
+	std::mergeable<
+	    std::ranges::iterator_t<Range1>,
+	    std::ranges::iterator_t<Range2>,
+	    Out, Comp, Proj1, Proj2>
+    auto set_difference(Policy&&, Range1&& range1, Range2&& range2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range1>, Out>
+    {
+	auto res{detail::partitioned_set_operation<Policy>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2), std::move(out), f, p1, p2,
+	    [&] (auto l1, auto r1, auto l2, auto r2, auto o) {
+		return detail::set_difference_merge<detail::consumable_range<Range1>>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    })};
+	return {std::move(res.in1), std::move(res.out)};
+    }
+
+
+    //************* set_intersection ********************
     
     template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
 	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
 	std::weakly_incrementable Out, typename Comp = std::ranges::less,
 	typename Proj1 = std::identity, typename Proj2 = std::identity>
     requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
-    constexpr auto set_union(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+    constexpr auto set_intersection(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
 	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
     {
-	while(left1 != right1 && left2 != right2) {
-	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
-		*out++ = *left1++;
-	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
-		*out++ = *left2++;
-	    else {
-		*out++ = *left1++;
-		++left2;
-	    }
-	}
-	auto res1 = ::alg::copy(std::move(left1), std::move(right1), std::move(out));
-	auto res2 = ::alg::copy(std::move(left2), std::move(right2), std::move(res1.out));
-	return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	return detail::set_intersection_merge<false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
     }
 
     template<std::ranges::input_range Range1,
@@ -160,40 +1091,372 @@ namespace alg
 	std::ranges::iterator_t<Range1>,
 	std::ranges::iterator_t<Range2>,
 	Out, Comp, Proj1, Proj2>
-    constexpr auto set_union(Range1&& range1, Range2&& range2,
+    constexpr auto set_intersection(Range1&& range1, Range2&& range2,
 	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
 	    std::ranges::borrowed_iterator_t<Range1>, 
 	    std::ranges::borrowed_iterator_t<Range2>, 
 	    Out>
     {
-	return ::alg::set_union(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
-	    std::move(out), std::move(f), std::move(p1), std::move(p2));
+	return detail::set_intersection_merge<detail::consumable_range<Range1>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
     }
 
 
-    //************** set_symmetric_difference *******************
-    
     template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
 	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
-	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	std::weakly_incrementable Out, typename Comp,
 	typename Proj1 = std::identity, typename Proj2 = std::identity>
-    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
-    constexpr auto set_symmetric_difference(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
-	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    requires concepts::indirectly_comparable_three_way<Iter1, Iter2, Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<Iter1, Out> && std::indirectly_copyable<Iter2, Out>
+    constexpr auto set_intersection(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
     {
-	while(left1 != right1 && left2 != right2) {
-	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
-		*out++ = *left1++;
-	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
-		*out++ = *left2++;
-	    else {
-		++left1;
-		++left2;
-	    }
-	}
-	auto res1 = ::alg::copy(std::move(left1), std::move(right1), std::move(out));
-	auto res2 = ::alg::copy(std::move(left2), std::move(right2), std::move(res1.out));
-	return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+	return detail::set_intersection_three_way<false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range1>, Out> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range2>, Out>
+    constexpr auto set_intersection(Range1&& range1, Range2&& range2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	return detail::set_intersection_three_way<detail::consumable_range<Range1>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
+    }
+
+
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter1, std::sized_sentinel_for<Iter1> Sent1,
+	std::random_access_iterator Iter2, std::sized_sentinel_for<Iter2> Sent2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    auto set_intersection(Policy&&, Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::partitioned_set_operation<Policy>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2,
+	    [&] (Iter1 l1, Iter1 r1, Iter2 l2, Iter2 r2, auto o) {
+		return detail::set_intersection_merge<false>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    });
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range1,
+	std::ranges::random_access_range Range2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::ranges::sized_range<Range1> && std::ranges::sized_range<Range2> &&
+	std::mergeable<
+	    std::ranges::iterator_t<Range1>,
+	    std::ranges::iterator_t<Range2>,
+	    Out, Comp, Proj1, Proj2>
+    auto set_intersection(Policy&&, Range1&& range1, Range2&& range2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	auto res{detail::partitioned_set_operation<Policy>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2), std::move(out), f, p1, p2,
+	    [&] (auto l1, auto r1, auto l2, auto r2, auto o) {
+		return detail::set_intersection_merge<detail::consumable_range<Range1>>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    })};
+	return {std::move(res.in1), std::move(res.in2), std::move(res.out)};
+    }
+
+
+    //************* set_intersection_size ***************
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_intersection_size(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	return detail::intersection_size(std::move(left1), std::move(right1), std::move(left2), std::move(right2), f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_intersection_size(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	return ::alg::set_intersection_size(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //************* set_union_size *************
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_union_size(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	const auto [n1, n2, common]{detail::intersection_sizes(std::move(left1), std::move(right1),
+		std::move(left2), std::move(right2), f, p1, p2)};
+	return n1 + n2 - common;
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_union_size(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	return ::alg::set_union_size(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //********** set_difference_size **********
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_difference_size(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	const auto [n1, n2, common]{detail::intersection_sizes(std::move(left1), std::move(right1),
+		std::move(left2), std::move(right2), f, p1, p2)};
+	return n1 - common;
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_difference_size(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	return ::alg::set_difference_size(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //***** set_symmetric_difference_size *****
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_symmetric_difference_size(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	const auto [n1, n2, common]{detail::intersection_sizes(std::move(left1), std::move(right1),
+		std::move(left2), std::move(right2), f, p1, p2)};
+	return n1 + n2 - 2 * common;
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto set_symmetric_difference_size(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::size_t
+    {
+	return ::alg::set_symmetric_difference_size(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //**************** jaccard ****************
+
+    // Size of the intersection over the size of the union, two empty inputs
+    // are identical and score 1
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto jaccard(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> double
+    {
+	const auto [n1, n2, common]{detail::intersection_sizes(std::move(left1), std::move(right1),
+		std::move(left2), std::move(right2), f, p1, p2)};
+	const auto united{n1 + n2 - common};
+	return united == 0 ? 1.0 : static_cast<double>(common) / static_cast<double>(united);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    [[nodiscard]] constexpr auto jaccard(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> double
+    {
+	return ::alg::jaccard(std::begin(range1), std::end(range1),
+		std::begin(range2), std::end(range2),
+		std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //****************** set_union *********************
+    
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    constexpr auto set_union(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::set_union_merge<false, false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Out, Comp, Proj1, Proj2>
+    constexpr auto set_union(Range1&& range1, Range2&& range2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>, 
+	    std::ranges::borrowed_iterator_t<Range2>, 
+	    Out>
+    {
+	return detail::set_union_merge<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
+    }
+
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	std::weakly_incrementable Out, typename Comp,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<Iter1, Iter2, Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<Iter1, Out> && std::indirectly_copyable<Iter2, Out>
+    constexpr auto set_union(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::set_union_three_way<false, false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range1>, Out> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range2>, Out>
+    constexpr auto set_union(Range1&& range1, Range2&& range2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	return detail::set_union_three_way<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
+    }
+
+
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter1, std::sized_sentinel_for<Iter1> Sent1,
+	std::random_access_iterator Iter2, std::sized_sentinel_for<Iter2> Sent2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    auto set_union(Policy&&, Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::partitioned_set_operation<Policy>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2,
+	    [&] (Iter1 l1, Iter1 r1, Iter2 l2, Iter2 r2, auto o) {
+		return detail::set_union_merge<false, false>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    });
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range1,
+	std::ranges::random_access_range Range2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::ranges::sized_range<Range1> && std::ranges::sized_range<Range2> &&
+	std::mergeable<
+	    std::ranges::iterator_t<Range1>,
+	    std::ranges::iterator_t<Range2>,
+	    Out, Comp, Proj1, Proj2>
+    auto set_union(Policy&&, Range1&& range1, Range2&& range2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	auto res{detail::partitioned_set_operation<Policy>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2), std::move(out), f, p1, p2,
+	    [&] (auto l1, auto r1, auto l2, auto r2, auto o) {
+		return detail::set_union_merge<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    })};
+	return {std::move(res.in1), std::move(res.in2), std::move(res.out)};
+    }
+
+
+    //************** set_symmetric_difference *******************
+    
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    constexpr auto set_symmetric_difference(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::set_symmetric_difference_merge<false, false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
     }
 
     template<std::ranges::input_range Range1,
@@ -210,8 +1473,328 @@ namespace alg
 	    std::ranges::borrowed_iterator_t<Range2>, 
 	    Out>
     {
-	return ::alg::set_symmetric_difference(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
-	    std::move(out), std::move(f), std::move(p1), std::move(p2));
+	return detail::set_symmetric_difference_merge<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
+    }
+
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	std::weakly_incrementable Out, typename Comp,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<Iter1, Iter2, Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<Iter1, Out> && std::indirectly_copyable<Iter2, Out>
+    constexpr auto set_symmetric_difference(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::set_symmetric_difference_three_way<false, false>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2);
+    }
+
+    template<std::ranges::input_range Range1,
+	std::ranges::input_range Range2,
+	std::weakly_incrementable Out, typename Comp,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires concepts::indirectly_comparable_three_way<
+	std::ranges::iterator_t<Range1>,
+	std::ranges::iterator_t<Range2>,
+	Comp, Proj1, Proj2> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range1>, Out> &&
+	std::indirectly_copyable<std::ranges::iterator_t<Range2>, Out>
+    constexpr auto set_symmetric_difference(Range1&& range1, Range2&& range2,
+	Out out, Comp f, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	return detail::set_symmetric_difference_three_way<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2),
+	    std::move(out), f, p1, p2);
+    }
+
+
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter1, std::sized_sentinel_for<Iter1> Sent1,
+	std::random_access_iterator Iter2, std::sized_sentinel_for<Iter2> Sent2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::mergeable<Iter1, Iter2, Out, Comp, Proj1, Proj2>
+    auto set_symmetric_difference(Policy&&, Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<Iter1, Iter2, Out>
+    {
+	return detail::partitioned_set_operation<Policy>(std::move(left1), std::move(right1), std::move(left2), std::move(right2),
+	    std::move(out), f, p1, p2,
+	    [&] (Iter1 l1, Iter1 r1, Iter2 l2, Iter2 r2, auto o) {
+		return detail::set_symmetric_difference_merge<false, false>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    });
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range1,
+	std::ranges::random_access_range Range2,
+	std::random_access_iterator Out, typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::ranges::sized_range<Range1> && std::ranges::sized_range<Range2> &&
+	std::mergeable<
+	    std::ranges::iterator_t<Range1>,
+	    std::ranges::iterator_t<Range2>,
+	    Out, Comp, Proj1, Proj2>
+    auto set_symmetric_difference(Policy&&, Range1&& range1, Range2&& range2,
+	Out out, Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::in_in_out_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>,
+	    Out>
+    {
+	auto res{detail::partitioned_set_operation<Policy>(std::begin(range1), std::end(range1),
+	    std::begin(range2), std::end(range2), std::move(out), f, p1, p2,
+	    [&] (auto l1, auto r1, auto l2, auto r2, auto o) {
+		return detail::set_symmetric_difference_merge<detail::consumable_range<Range1>, detail::consumable_range<Range2>>(l1, r1, l2, r2, std::move(o), f, p1, p2).out;
+	    })};
+	return {std::move(res.in1), std::move(res.in2), std::move(res.out)};
+    }
+
+
+    //************* set_difference_inplace **************
+
+    // Compacts the elements of range1 that are not matched in range2 to its
+    // front, like remove, and returns the leftover tail
+    template<std::permutable Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    constexpr auto set_difference_inplace(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::subrange<Iter1>
+    {
+	auto out{left1};
+	while(left1 != right1 && left2 != right2) {
+	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2))) {
+		if(out != left1)
+		    *out = std::ranges::iter_move(left1);
+		++out, ++left1;
+	    }
+	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		++left2;
+	    else
+		++left1, ++left2;
+	}
+
+	if(out == left1) {
+	    auto last{std::ranges::next(std::move(left1), std::move(right1))};
+	    return {last, last};
+	}
+	auto res = ::alg::move(std::move(left1), std::move(right1), std::move(out));
+	return {std::move(res.out), std::move(res.in)};
+    }
+
+    template<std::ranges::forward_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    requires std::permutable<std::ranges::iterator_t<Range1>>
+    constexpr auto set_difference_inplace(Range1&& range1, Range2&& range2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::borrowed_subrange_t<Range1>
+    {
+	return ::alg::set_difference_inplace(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
+	    std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //************ set_intersection_inplace *************
+
+    // Compacts the elements of range1 that are matched in range2 to its front
+    // and returns the leftover tail
+    template<std::permutable Iter1, std::sentinel_for<Iter1> Sent1,
+	std::input_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<Iter1, Proj1>,
+	    std::projected<Iter2, Proj2>> Comp = std::ranges::less>
+    constexpr auto set_intersection_inplace(Iter1 left1, Sent1 right1, Iter2 left2, Sent2 right2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::subrange<Iter1>
+    {
+	auto out{left1};
+	while(left1 != right1 && left2 != right2) {
+	    if(std::invoke(f, std::invoke(p1, *left1), std::invoke(p2, *left2)))
+		++left1;
+	    else if(std::invoke(f, std::invoke(p2, *left2), std::invoke(p1, *left1)))
+		++left2;
+	    else {
+		if(out != left1)
+		    *out = std::ranges::iter_move(left1);
+		++out, ++left1, ++left2;
+	    }
+	}
+	return {std::move(out), std::ranges::next(std::move(left1), std::move(right1))};
+    }
+
+    template<std::ranges::forward_range Range1,
+	std::ranges::input_range Range2,
+	typename Proj1 = std::identity, typename Proj2 = std::identity,
+	std::indirect_strict_weak_order<
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>> Comp = std::ranges::less>
+    requires std::permutable<std::ranges::iterator_t<Range1>>
+    constexpr auto set_intersection_inplace(Range1&& range1, Range2&& range2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::borrowed_subrange_t<Range1>
+    {
+	return ::alg::set_intersection_inplace(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
+	    std::move(f), std::move(p1), std::move(p2));
+    }
+
+
+    //***************** set_union_into ******************
+
+    namespace detail
+    {
+
+	// Backward merge of set_union_into once the end of the union is known
+	template<typename Iter1, typename Iter2, typename Comp, typename Proj1, typename Proj2>
+	constexpr void union_into_backwards(Iter1 left1, Iter1 mid1, Iter2 left2, Iter2 last2, Iter1 last,
+	    Comp& f, Proj1& p1, Proj2& p2)
+	{
+	    auto out{last};
+	    while(out != mid1) {
+		if(mid1 == left1) {
+		    ::alg::copy_backwards(left2, last2, std::move(out));
+		    break;
+		}
+
+		const auto prev1{std::ranges::prev(mid1)};
+		const auto prev2{std::ranges::prev(last2)};
+		if(std::invoke(f, std::invoke(p1, *prev1), std::invoke(p2, *prev2))) {
+		    *--out = *prev2;
+		    last2 = prev2;
+		}
+		else if(std::invoke(f, std::invoke(p2, *prev2), std::invoke(p1, *prev1))) {
+		    *--out = std::ranges::iter_move(prev1);
+		    mid1 = prev1;
+		}
+		else {
+		    // Forward set_union writes the whole group of range1 followed
+		    // by the elements of range2's group beyond its size
+		    auto group1{prev1}, group2{prev2};
+		    std::iter_difference_t<Iter1> n1{1};
+		    std::iter_difference_t<Iter2> n2{1};
+		    for(; group1 != left1 && !std::invoke(f, std::invoke(p1, *std::ranges::prev(group1)), std::invoke(p2, *prev2)); --group1)
+			++n1;
+		    for(; group2 != left2 && !std::invoke(f, std::invoke(p2, *std::ranges::prev(group2)), std::invoke(p2, *prev2)); --group2)
+			++n2;
+
+		    if(n2 > n1)
+			out = ::alg::copy_backwards(std::ranges::next(group2, static_cast<std::iter_difference_t<Iter2>>(n1)), last2, std::move(out)).out;
+		    out = ::alg::move_backwards(group1, mid1, std::move(out)).out;
+		    mid1 = group1;
+		    last2 = group2;
+		}
+	    }
+	}
+
+    }
+
+    // Merges [left2, right2) into the sorted [left1, mid1), which must be
+    // followed by room for the elements of range2 that are not matched in it.
+    // Works from the back so nothing is moved more than once, and stops as
+    // soon as the rest of range1 is already in place. Returns the end of the
+    // union, which holds the same elements as set_union would write.
+    template<std::bidirectional_iterator Iter1,
+	std::bidirectional_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::permutable<Iter1> && std::mergeable<Iter1, Iter2, Iter1, Comp, Proj1, Proj2>
+    constexpr auto set_union_into(Iter1 left1, Iter1 mid1, Iter2 left2, Sent2 right2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> Iter1
+    {
+	auto last2{std::ranges::next(left2, std::move(right2))};
+	const auto size{::alg::set_union_size(left1, mid1, left2, last2, std::ref(f), std::ref(p1), std::ref(p2))};
+	const auto last{std::ranges::next(left1, static_cast<std::iter_difference_t<Iter1>>(size))};
+	detail::union_into_backwards(std::move(left1), std::move(mid1), std::move(left2), std::move(last2), last, f, p1, p2);
+	return last;
+    }
+
+    template<std::ranges::bidirectional_range Container,
+	std::ranges::bidirectional_range Range2,
+	typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::ranges::sized_range<Container> &&
+	std::permutable<std::ranges::iterator_t<Container>> &&
+	std::mergeable<
+	    std::ranges::iterator_t<Container>,
+	    std::ranges::iterator_t<Range2>,
+	    std::ranges::iterator_t<Container>,
+	    Comp, Proj1, Proj2> &&
+	requires(Container& c, std::size_t n) { c.resize(n); }
+    constexpr auto set_union_into(Container& container, Range2&& range2,
+	Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {}) -> std::ranges::iterator_t<Container>
+    {
+	const auto size1{std::ranges::distance(container)};
+	const auto size{::alg::set_union_size(container, range2, std::ref(f), std::ref(p1), std::ref(p2))};
+	container.resize(size);
+	const auto left{std::begin(container)};
+	const auto last{std::ranges::next(left, static_cast<std::ranges::range_difference_t<Container>>(size))};
+	detail::union_into_backwards(left, std::ranges::next(left, size1),
+	    std::ranges::begin(range2), std::ranges::next(std::ranges::begin(range2), std::ranges::end(range2)), last, f, p1, p2);
+	return last;
+    }
+
+
+    //******************** merge_k **********************
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj = std::identity>
+    requires detail::run_iterator<Iter> &&
+	std::indirectly_copyable<detail::run_element_iterator_t<Iter>, Out> &&
+	std::indirect_strict_weak_order<Comp, std::projected<detail::run_element_iterator_t<Iter>, Proj>>
+    constexpr auto merge_k(Iter left, Sent right, Out out, Comp f = {}, Proj p = {}) -> Out
+    {
+	return detail::merge_runs<false>(std::move(left), std::move(right), std::move(out), f, p);
+    }
+
+    template<std::ranges::input_range Range,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj = std::identity>
+    requires detail::run_iterator<std::ranges::iterator_t<Range>> &&
+	std::indirectly_copyable<detail::run_element_iterator_t<std::ranges::iterator_t<Range>>, Out> &&
+	std::indirect_strict_weak_order<Comp, std::projected<detail::run_element_iterator_t<std::ranges::iterator_t<Range>>, Proj>>
+    constexpr auto merge_k(Range&& ranges, Out out, Comp f = {}, Proj p = {}) -> Out
+    {
+	return detail::merge_runs<detail::consumable_runs<Range>>(std::begin(ranges), std::end(ranges),
+	    std::move(out), f, p);
+    }
+
+
+    //****************** set_union_k ********************
+
+    // Every value is emitted as many times as the run holding it most often,
+    // taking the copies from the lowest runs first like set_union does
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj = std::identity>
+    requires detail::run_iterator<Iter> &&
+	std::forward_iterator<detail::run_element_iterator_t<Iter>> &&
+	std::indirectly_copyable<detail::run_element_iterator_t<Iter>, Out> &&
+	std::indirect_strict_weak_order<Comp, std::projected<detail::run_element_iterator_t<Iter>, Proj>>
+    constexpr auto set_union_k(Iter left, Sent right, Out out, Comp f = {}, Proj p = {}) -> Out
+    {
+	return detail::union_runs<false>(std::move(left), std::move(right), std::move(out), f, p);
+    }
+
+    template<std::ranges::input_range Range,
+	std::weakly_incrementable Out, typename Comp = std::ranges::less,
+	typename Proj = std::identity>
+    requires detail::run_iterator<std::ranges::iterator_t<Range>> &&
+	std::forward_iterator<detail::run_element_iterator_t<std::ranges::iterator_t<Range>>> &&
+	std::indirectly_copyable<detail::run_element_iterator_t<std::ranges::iterator_t<Range>>, Out> &&
+	std::indirect_strict_weak_order<Comp, std::projected<detail::run_element_iterator_t<std::ranges::iterator_t<Range>>, Proj>>
+    constexpr auto set_union_k(Range&& ranges, Out out, Comp f = {}, Proj p = {}) -> Out
+    {
+	return detail::union_runs<detail::consumable_runs<Range>>(std::begin(ranges), std::end(ranges),
+	    std::move(out), f, p);
     }
 
 
@@ -0,0 +1,1272 @@
+#pragma once
+
+#include <iterator>
+#include <ranges>
+#include <functional>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utility_concepts.hpp"
+#include "modifying_operations.hpp"
+#include "minmax_operations.hpp"
+#include "binary_search_operations.hpp"
+#include "execution.hpp"
+
+namespace alg
+{
+
+    namespace detail
+    {
+
+	inline constexpr std::ptrdiff_t insertion_sort_threshold{24};
+	inline constexpr std::ptrdiff_t ninther_threshold{128};
+	inline constexpr std::ptrdiff_t partial_insertion_limit{8};
+	inline constexpr std::size_t partition_block{64};
+
+	// Comparisons on arithmetic keys under the natural orders are cheap enough
+	// that deciding sides without branches beats predicting them
+	template<typename Iter, typename Comp, typename Proj>
+	concept block_partitionable =
+	    std::is_arithmetic_v<std::remove_cvref_t<std::indirect_result_t<Proj&, Iter>>> &&
+	    concepts::any_of<std::unwrap_reference_t<Comp>,
+		std::ranges::less, std::less<>, std::ranges::greater, std::greater<>>;
+
+	template<typename Comp, typename Proj>
+	[[nodiscard]] constexpr auto projected_less(Comp& f, Proj& p)
+	{
+	    return [&f, &p] (auto&& a, auto&& b) -> bool {
+		return std::invoke(f, std::invoke(p, std::forward<decltype(a)>(a)), std::invoke(p, std::forward<decltype(b)>(b)));
+	    };
+	}
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void insertion_sort(Iter first, Iter last, Less& less)
+	{
+	    if(first == last)
+		return;
+
+	    for(auto cur{first + 1}; cur != last; ++cur)
+		if(less(*cur, *(cur - 1))) {
+		    auto tmp{std::ranges::iter_move(cur)};
+		    auto sift{cur};
+		    do
+			*sift = std::ranges::iter_move(sift - 1);
+		    while(--sift != first && less(tmp, *(sift - 1)));
+		    *sift = std::move(tmp);
+		}
+	}
+
+	// Requires an element before first that is not greater than any in [first, last)
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void unguarded_insertion_sort(Iter first, Iter last, Less& less)
+	{
+	    if(first == last)
+		return;
+
+	    for(auto cur{first + 1}; cur != last; ++cur)
+		if(less(*cur, *(cur - 1))) {
+		    auto tmp{std::ranges::iter_move(cur)};
+		    auto sift{cur};
+		    do
+			*sift = std::ranges::iter_move(sift - 1);
+		    while(less(tmp, *(--sift - 1)));
+		    *sift = std::move(tmp);
+		}
+	}
+
+	// Gives up and returns false once more than a handful of elements had to move
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr auto partial_insertion_sort(Iter first, Iter last, Less& less) -> bool
+	{
+	    if(first == last)
+		return true;
+
+	    std::iter_difference_t<Iter> moved{};
+	    for(auto cur{first + 1}; cur != last; ++cur) {
+		if(less(*cur, *(cur - 1))) {
+		    auto tmp{std::ranges::iter_move(cur)};
+		    auto sift{cur};
+		    do
+			*sift = std::ranges::iter_move(sift - 1);
+		    while(--sift != first && less(tmp, *(sift - 1)));
+		    *sift = std::move(tmp);
+		    moved += cur - sift;
+		}
+		if(moved > partial_insertion_limit)
+		    return false;
+	    }
+	    return true;
+	}
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void sort2(Iter a, Iter b, Less& less)
+	{
+	    if(less(*b, *a))
+		std::ranges::iter_swap(a, b);
+	}
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void sort3(Iter a, Iter b, Iter c, Less& less)
+	{
+	    sort2(a, b, less);
+	    sort2(b, c, less);
+	    sort2(a, b, less);
+	}
+
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void heap_sort(Iter first, Iter last, Less& less)
+	{
+	    const auto n{last - first};
+	    for(auto i{n / 2}; i-- > 0;)
+		heap_sift_down(first, n, i, less);
+	    for(auto k{n}; k > 1; --k) {
+		std::ranges::iter_swap(first, first + (k - 1));
+		heap_sift_down(first, k - 1, std::iter_difference_t<Iter>{}, less);
+	    }
+	}
+
+	// Sorts input that is entirely non-descending or non-ascending in one pass
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr auto sort_presorted(Iter first, Iter last, Less& less) -> bool
+	{
+	    if(last - first < 2)
+		return true;
+
+	    auto cur{first + 1};
+	    if(less(*cur, *first)) {
+		while(++cur != last && !less(*(cur - 1), *cur));
+		if(cur != last)
+		    return false;
+		::alg::reverse(first, last);
+		return true;
+	    }
+
+	    while(++cur != last && !less(*cur, *(cur - 1)));
+	    return cur == last;
+	}
+
+	// Elements equal to the pivot at first go to the left part, the pivot ends
+	// up at the returned position. Used when the range is known to start with
+	// the smallest value of its parent partition.
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr auto partition_left(Iter first, Iter last, Less& less) -> Iter
+	{
+	    auto pivot{std::ranges::iter_move(first)};
+	    auto l{first}, r{last};
+
+	    while(less(pivot, *--r));
+	    if(r + 1 == last)
+		while(l < r && !less(pivot, *++l));
+	    else
+		while(!less(pivot, *++l));
+
+	    while(l < r) {
+		std::ranges::iter_swap(l, r);
+		while(less(pivot, *--r));
+		while(!less(pivot, *++l));
+	    }
+
+	    *first = std::ranges::iter_move(r);
+	    *r = std::move(pivot);
+	    return r;
+	}
+
+	// Elements equal to the pivot at first go to the right part. Also reports
+	// whether no element had to be swapped.
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr auto partition_right(Iter first, Iter last, Less& less) -> std::pair<Iter, bool>
+	{
+	    auto pivot{std::ranges::iter_move(first)};
+	    auto l{first}, r{last};
+
+	    while(less(*++l, pivot));
+	    if(l - 1 == first)
+		while(l < r && !less(*--r, pivot));
+	    else
+		while(!less(*--r, pivot));
+
+	    const bool partitioned{l >= r};
+	    while(l < r) {
+		std::ranges::iter_swap(l, r);
+		while(less(*++l, pivot));
+		while(!less(*--r, pivot));
+	    }
+
+	    const auto pivot_pos{l - 1};
+	    *first = std::ranges::iter_move(pivot_pos);
+	    *pivot_pos = std::move(pivot);
+	    return {pivot_pos, partitioned};
+	}
+
+	// Exchanges the misplaced elements recorded by a block partition. Equal
+	// counts on both sides use plain swaps so descending input stays linear,
+	// otherwise a single cyclic permutation saves a third of the moves.
+	template<std::random_access_iterator Iter>
+	constexpr void swap_offsets(Iter lbase, Iter rbase, const unsigned char* loff, const unsigned char* roff,
+		std::size_t n, bool use_swaps)
+	{
+	    if(use_swaps) {
+		for(std::size_t i{}; i != n; ++i)
+		    std::ranges::iter_swap(lbase + loff[i], rbase - roff[i]);
+	    }
+	    else if(n != 0) {
+		auto l{lbase + loff[0]};
+		auto r{rbase - roff[0]};
+		auto tmp{std::ranges::iter_move(l)};
+		*l = std::ranges::iter_move(r);
+		for(std::size_t i{1}; i != n; ++i) {
+		    l = lbase + loff[i];
+		    *r = std::ranges::iter_move(l);
+		    r = rbase - roff[i];
+		    *l = std::ranges::iter_move(r);
+		}
+		*r = std::move(tmp);
+	    }
+	}
+
+	// partition_right with the comparisons of a block of elements recorded as
+	// offsets first and the swaps done afterwards, as in BlockQuicksort, so
+	// that no branch depends on a comparison result
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr auto partition_right_branchless(Iter first, Iter last, Less& less) -> std::pair<Iter, bool>
+	{
+	    constexpr auto block{partition_block};
+
+	    auto pivot{std::ranges::iter_move(first)};
+	    auto l{first}, r{last};
+
+	    while(less(*++l, pivot));
+	    if(l - 1 == first)
+		while(l < r && !less(*--r, pivot));
+	    else
+		while(!less(*--r, pivot));
+
+	    const bool partitioned{l >= r};
+	    if(!partitioned) {
+		std::ranges::iter_swap(l, r);
+		++l;
+
+		unsigned char loff[block], roff[block];
+		auto lbase{l}, rbase{r};
+		std::size_t nl{}, nr{}, sl{}, sr{};
+
+		while(l < r) {
+		    const auto unknown{static_cast<std::size_t>(r - l)};
+		    const auto lsplit{nl == 0 ? (nr == 0 ? unknown / 2 : unknown) : 0};
+		    const auto rsplit{nr == 0 ? unknown - lsplit : 0};
+
+		    for(std::size_t i{}, n{std::min(lsplit, block)}; i != n; ++l) {
+			loff[nl] = static_cast<unsigned char>(i++);
+			nl += !less(*l, pivot);
+		    }
+		    for(std::size_t i{}, n{std::min(rsplit, block)}; i != n;) {
+			roff[nr] = static_cast<unsigned char>(++i);
+			nr += less(*--r, pivot);
+		    }
+
+		    const auto n{std::min(nl, nr)};
+		    swap_offsets(lbase, rbase, loff + sl, roff + sr, n, nl == nr);
+		    nl -= n;
+		    nr -= n;
+		    sl += n;
+		    sr += n;
+
+		    if(nl == 0) {
+			sl = 0;
+			lbase = l;
+		    }
+		    if(nr == 0) {
+			sr = 0;
+			rbase = r;
+		    }
+		}
+
+		// One side may still hold misplaced elements, they go to the boundary
+		if(nl != 0) {
+		    while(nl-- != 0)
+			std::ranges::iter_swap(lbase + loff[sl + nl], --r);
+		    l = r;
+		}
+		if(nr != 0) {
+		    while(nr-- != 0)
+			std::ranges::iter_swap(rbase - roff[sr + nr], l++);
+		    r = l;
+		}
+	    }
+
+	    const auto pivot_pos{l - 1};
+	    *first = std::ranges::iter_move(pivot_pos);
+	    *pivot_pos = std::move(pivot);
+	    return {pivot_pos, partitioned};
+	}
+
+	// Pattern-defeating quicksort. Partitions around a median of three (a
+	// pseudo-median of nine on large slices), leaves runs of equal elements
+	// alone once seen, switches to insertion sort on small slices and on
+	// partitions that needed no swaps, and breaks patterns with a few swaps
+	// after an unbalanced partition, falling back to heapsort after log(n) of them.
+	template<bool Branchless, std::random_access_iterator Iter, typename Less>
+	constexpr void pdq_sort(Iter first, Iter last, Less& less, int bad_allowed, bool leftmost)
+	{
+	    for(;;) {
+		const auto n{last - first};
+		if(n < insertion_sort_threshold) {
+		    if(leftmost)
+			insertion_sort(first, last, less);
+		    else
+			unguarded_insertion_sort(first, last, less);
+		    return;
+		}
+
+		const auto half{n / 2};
+		if(n > ninther_threshold) {
+		    sort3(first, first + half, last - 1, less);
+		    sort3(first + 1, first + (half - 1), last - 2, less);
+		    sort3(first + 2, first + (half + 1), last - 3, less);
+		    sort3(first + (half - 1), first + half, first + (half + 1), less);
+		    std::ranges::iter_swap(first, first + half);
+		}
+		else
+		    sort3(first + half, first, last - 1, less);
+
+		// A pivot equal to the element before this slice is its minimum,
+		// so everything equal to it is already in place
+		if(!leftmost && !less(*(first - 1), *first)) {
+		    first = partition_left(first, last, less) + 1;
+		    continue;
+		}
+
+		const auto [pivot_pos, partitioned]{Branchless ?
+		    partition_right_branchless(first, last, less) :
+		    partition_right(first, last, less)};
+
+		const auto lsize{pivot_pos - first};
+		const auto rsize{last - (pivot_pos + 1)};
+
+		if(lsize < n / 8 || rsize < n / 8) {
+		    if(--bad_allowed == 0) {
+			heap_sort(first, last, less);
+			return;
+		    }
+
+		    if(lsize >= insertion_sort_threshold) {
+			std::ranges::iter_swap(first, first + lsize / 4);
+			std::ranges::iter_swap(pivot_pos - 1, pivot_pos - lsize / 4);
+			if(lsize > ninther_threshold) {
+			    std::ranges::iter_swap(first + 1, first + (lsize / 4 + 1));
+			    std::ranges::iter_swap(first + 2, first + (lsize / 4 + 2));
+			    std::ranges::iter_swap(pivot_pos - 2, pivot_pos - (lsize / 4 + 1));
+			    std::ranges::iter_swap(pivot_pos - 3, pivot_pos - (lsize / 4 + 2));
+			}
+		    }
+		    if(rsize >= insertion_sort_threshold) {
+			std::ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + rsize / 4));
+			std::ranges::iter_swap(last - 1, last - rsize / 4);
+			if(rsize > ninther_threshold) {
+			    std::ranges::iter_swap(pivot_pos + 2, pivot_pos + (2 + rsize / 4));
+			    std::ranges::iter_swap(pivot_pos + 3, pivot_pos + (3 + rsize / 4));
+			    std::ranges::iter_swap(last - 2, last - (1 + rsize / 4));
+			    std::ranges::iter_swap(last - 3, last - (2 + rsize / 4));
+			}
+		    }
+		}
+		else if(partitioned && partial_insertion_sort(first, pivot_pos, less) &&
+			partial_insertion_sort(pivot_pos + 1, last, less))
+		    return;
+
+		pdq_sort<Branchless>(first, pivot_pos, less, bad_allowed, leftmost);
+		first = pivot_pos + 1;
+		leftmost = false;
+	    }
+	}
+
+	template<std::random_access_iterator Iter, typename Comp, typename Proj>
+	constexpr void sort(Iter first, Iter last, Comp& f, Proj& p)
+	{
+	    auto less{projected_less(f, p)};
+	    if(sort_presorted(first, last, less))
+		return;
+
+	    const auto bad_allowed{std::bit_width(static_cast<std::size_t>(last - first))};
+	    pdq_sort<block_partitionable<Iter, Comp, Proj>>(first, last, less, static_cast<int>(bad_allowed), true);
+	}
+
+
+	inline constexpr std::size_t sample_sort_max_buckets{128};
+
+	// Splitters are kept as copies of projected keys, scattered elements have
+	// to be moved into uninitialised storage without a way to back out
+	template<typename Iter, typename Proj>
+	concept sample_sortable =
+	    std::is_nothrow_move_constructible_v<std::iter_value_t<Iter>> &&
+	    std::copy_constructible<std::iter_value_t<std::projected<Iter, Proj>>>;
+
+	// splitmix64, spreads the sample over the whole range
+	[[nodiscard]] constexpr auto sample_position(std::uint64_t i, std::uint64_t n) -> std::uint64_t
+	{
+	    i += 0x9e3779b97f4a7c15;
+	    i = (i ^ (i >> 30)) * 0xbf58476d1ce4e5b9;
+	    i = (i ^ (i >> 27)) * 0x94d049bb133111eb;
+	    return (i ^ (i >> 31)) % n;
+	}
+
+	// Parallel super scalar sample sort. Splitters are taken from a sorted,
+	// oversampled set of keys and laid out as an implicit search tree, so
+	// classifying an element is log(buckets) comparisons without branches.
+	// Every splitter also gets a bucket for the elements equal to it, which
+	// need no sorting and keep heavy duplicates from unbalancing the rest.
+	// Chunks of the input are classified in parallel, scattered into a buffer
+	// at offsets known from the per-chunk counts, and every bucket is moved
+	// back and sorted on its own.
+	template<std::random_access_iterator Iter, typename Comp, typename Proj>
+	void sample_sort(Iter first, std::size_t n, std::size_t chunks, Comp& f, Proj& p)
+	{
+	    using diff_t = std::iter_difference_t<Iter>;
+	    using value_t = std::iter_value_t<Iter>;
+	    using key_t = std::iter_value_t<std::projected<Iter, Proj>>;
+
+	    const std::size_t buckets{std::clamp<std::size_t>(std::bit_ceil(4 * chunks), 2, sample_sort_max_buckets)};
+	    const std::size_t oversampling{std::max<std::size_t>(std::bit_width(n) / 4, 1)};
+	    const auto levels{std::countr_zero(buckets)};
+
+	    std::vector<key_t> sample;
+	    sample.reserve(buckets * oversampling);
+	    for(std::size_t i{}; i != buckets * oversampling; ++i)
+		sample.emplace_back(std::invoke(p, first[static_cast<diff_t>(sample_position(i, n))]));
+	    std::identity identity;
+	    sort(std::begin(sample), std::end(sample), f, identity);
+
+	    // Equal splitters are dropped and the list padded with the last one,
+	    // the buckets between copies of it stay empty
+	    std::vector<key_t> splitters;
+	    splitters.reserve(buckets - 1);
+	    for(std::size_t b{1}; b != buckets; ++b)
+		if(splitters.empty() || std::invoke(f, splitters.back(), sample[b * oversampling]))
+		    splitters.push_back(sample[b * oversampling]);
+	    while(std::size(splitters) != buckets - 1)
+		splitters.push_back(splitters.back());
+
+	    // Node i of the tree sits at depth d = log2(i), j = i - 2^d nodes into its level
+	    std::vector<key_t> tree;
+	    tree.reserve(buckets);
+	    tree.push_back(splitters.front());
+	    for(std::size_t node{1}; node != buckets; ++node) {
+		const auto depth{static_cast<std::size_t>(std::bit_width(node) - 1)};
+		const auto j{node - (std::size_t{1} << depth)};
+		tree.push_back(splitters[(2 * j + 1) * (buckets >> (depth + 1)) - 1]);
+	    }
+
+	    const auto classify = [&] (auto&& key) -> std::uint8_t {
+		std::size_t b{1};
+		for(int level{}; level != levels; ++level)
+		    b = 2 * b + static_cast<std::size_t>(std::invoke(f, tree[b], key));
+		b -= buckets;
+		const bool equal{b != buckets - 1 && !std::invoke(f, key, splitters[b])};
+		return static_cast<std::uint8_t>(2 * b + equal);
+	    };
+
+	    const auto ids{2 * buckets};
+	    std::vector<std::uint8_t> id(n);
+	    std::vector<std::size_t> offsets(chunks * ids);
+	    for_each_chunk(chunks, n, [&] (std::size_t chunk, std::size_t l, std::size_t r) {
+		auto* count{&offsets[chunk * ids]};
+		for(auto i{l}; i != r; ++i)
+		    ++count[id[i] = classify(std::invoke(p, first[static_cast<diff_t>(i)]))];
+	    });
+
+	    std::vector<std::size_t> bounds(ids + 1);
+	    std::size_t total{};
+	    for(std::size_t b{}; b != ids; ++b) {
+		bounds[b] = total;
+		for(std::size_t chunk{}; chunk != chunks; ++chunk)
+		    total += std::exchange(offsets[chunk * ids + b], total);
+	    }
+	    bounds[ids] = total;
+
+	    std::allocator<value_t> alloc;
+	    const auto deallocate = [&alloc, n] (value_t* data) { alloc.deallocate(data, n); };
+	    const std::unique_ptr<value_t, decltype(deallocate)> buffer{alloc.allocate(n), deallocate};
+
+	    for_each_chunk(chunks, n, [&] (std::size_t chunk, std::size_t l, std::size_t r) {
+		auto* offset{&offsets[chunk * ids]};
+		for(auto i{l}; i != r; ++i)
+		    std::construct_at(buffer.get() + offset[id[i]]++, std::ranges::iter_move(first + static_cast<diff_t>(i)));
+	    });
+
+	    thread_pool::instance().run(ids, [&] (std::size_t b) {
+		const auto l{first + static_cast<diff_t>(bounds[b])};
+		const auto r{first + static_cast<diff_t>(bounds[b + 1])};
+		auto* data{buffer.get() + bounds[b]};
+		for(auto out{l}; out != r; ++out, ++data) {
+		    *out = std::move(*data);
+		    std::destroy_at(data);
+		}
+		if(b % 2 == 0)
+		    sort(l, r, f, p);
+	    });
+	}
+
+
+	template<typename T>
+	concept radix_key = (std::integral<T> && !std::same_as<T, bool>) || concepts::any_of<T, float, double>;
+
+	template<typename T>
+	using radix_bits_t = typename std::conditional_t<std::integral<T>,
+	    std::make_unsigned<T>,
+	    std::conditional<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>>::type;
+
+	inline constexpr std::size_t radix_sort_threshold{64};
+
+	// Maps a key to an unsigned integer with the same order: signed integers
+	// get their sign bit flipped, negative floats all of their bits and
+	// positive floats only the sign bit. Negative NaNs end up first, positive
+	// ones last.
+	template<radix_key T>
+	constexpr auto radix_bits(T value) -> radix_bits_t<T>
+	{
+	    using bits_t = radix_bits_t<T>;
+	    constexpr auto top{std::numeric_limits<bits_t>::digits - 1};
+	    constexpr bits_t sign{static_cast<bits_t>(bits_t{1} << top)};
+
+	    if constexpr(std::floating_point<T>) {
+		const auto bits{std::bit_cast<bits_t>(value)};
+		return bits ^ (static_cast<bits_t>(bits_t{} - (bits >> top)) | sign);
+	    }
+	    else if constexpr(std::signed_integral<T>)
+		return static_cast<bits_t>(static_cast<bits_t>(value) ^ sign);
+	    else
+		return static_cast<bits_t>(value);
+	}
+
+	// Uninitialized scratch space. When alloc cannot provide the size asked
+	// for, successively halved sizes are tried down to none at all.
+	template<typename T, typename Alloc>
+	class merge_buffer
+	{
+	    using alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+	    using traits = std::allocator_traits<alloc_t>;
+
+	public:
+	    merge_buffer(std::ptrdiff_t wanted, const Alloc& alloc) : alloc(alloc)
+	    {
+		for(size = wanted; size > 0; size /= 2)
+		    try {
+			storage = traits::allocate(this->alloc, static_cast<std::size_t>(size));
+			return;
+		    } catch(const std::bad_alloc&) {}
+	    }
+
+	    merge_buffer(const merge_buffer&) = delete;
+	    merge_buffer& operator=(const merge_buffer&) = delete;
+
+	    ~merge_buffer()
+	    {
+		if(storage)
+		    traits::deallocate(alloc, storage, static_cast<std::size_t>(size));
+	    }
+
+	    [[nodiscard]] auto data() const noexcept -> T* { return storage; }
+	    [[nodiscard]] auto capacity() const noexcept -> std::ptrdiff_t { return size; }
+
+	private:
+	    alloc_t alloc;
+	    T* storage{};
+	    std::ptrdiff_t size{};
+	};
+
+	// LSD radix sort on bytes of the mapped keys. All byte histograms are
+	// taken in one pass up front, which also shows the bytes every key shares:
+	// their passes are skipped. Elements ping-pong between the range and one
+	// scratch buffer and are moved back at the end if they finish there.
+	// Trivially copyable elements are scattered straight into raw storage,
+	// anything else is moved into a vector first.
+	template<std::random_access_iterator Iter, typename Proj, typename Alloc>
+	void radix_sort(Iter first, Iter last, Proj& p, const Alloc& alloc)
+	{
+	    using value_t = std::iter_value_t<Iter>;
+	    using key_t = std::remove_cvref_t<std::indirect_result_t<Proj&, Iter>>;
+	    using bits_t = radix_bits_t<key_t>;
+	    using alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<value_t>;
+	    constexpr std::size_t bytes{sizeof(bits_t)};
+
+	    const auto key = [&p] (auto&& value) { return radix_bits(std::invoke(p, value)); };
+	    const auto n{static_cast<std::size_t>(last - first)};
+
+	    // Insertion sort only moves strictly smaller keys, so it is stable too
+	    if(n < radix_sort_threshold) {
+		auto less = [&key] (auto&& a, auto&& b) { return key(a) < key(b); };
+		insertion_sort(first, last, less);
+		return;
+	    }
+
+	    std::array<std::array<std::size_t, 256>, bytes> counts{};
+	    for(auto it{first}; it != last; ++it) {
+		const auto bits{key(*it)};
+		for(std::size_t d{}; d != bytes; ++d)
+		    ++counts[d][(bits >> (8 * d)) & 0xff];
+	    }
+
+	    std::optional<merge_buffer<value_t, Alloc>> raw;
+	    std::vector<value_t, alloc_t> moved{alloc_t(alloc)};
+	    value_t* buffer{};
+	    bool in_buffer{false};
+
+	    const auto scatter = [&key] (auto src, auto src_end, auto dst, auto& offsets, std::size_t d) {
+		for(; src != src_end; ++src) {
+		    const auto digit{(key(*src) >> (8 * d)) & 0xff};
+		    dst[static_cast<std::iter_difference_t<decltype(dst)>>(offsets[digit]++)] = std::ranges::iter_move(src);
+		}
+	    };
+
+	    for(std::size_t d{}; d != bytes; ++d) {
+		if(::alg::find(counts[d], n) != std::end(counts[d]))
+		    continue;
+
+		if(!buffer) {
+		    if constexpr(std::is_trivially_copyable_v<value_t>) {
+			raw.emplace(static_cast<std::ptrdiff_t>(n), alloc);
+			if(raw->capacity() != static_cast<std::ptrdiff_t>(n))
+			    throw std::bad_alloc{};
+			buffer = raw->data();
+		    }
+		    else {
+			moved.reserve(n);
+			::alg::move(first, last, std::back_inserter(moved));
+			buffer = moved.data();
+			in_buffer = true;
+		    }
+		}
+
+		std::array<std::size_t, 256> offsets;
+		std::exclusive_scan(std::begin(counts[d]), std::end(counts[d]), std::begin(offsets), std::size_t{});
+
+		if(in_buffer)
+		    scatter(buffer, buffer + n, first, offsets, d);
+		else
+		    scatter(first, last, buffer, offsets, d);
+		in_buffer = !in_buffer;
+	    }
+
+	    if(in_buffer)
+		::alg::move(buffer, buffer + n, first);
+	}
+
+
+	inline constexpr std::ptrdiff_t stable_min_run{24};
+	inline constexpr std::ptrdiff_t min_gallop{7};
+
+	// A run moved into merge scratch space. Whatever is left of it when the
+	// merge ends, normally or through an exception, is moved to the gap that
+	// starts (Forward) or ends at out.
+	template<bool Forward, typename T, typename Iter>
+	class buffered_run
+	{
+	public:
+	    buffered_run(T* storage, Iter from, Iter to, Iter& out) : storage{storage}, first{storage}, last{storage}, end{storage}, out{out}
+	    {
+		for(; from != to; ++from, ++end)
+		    std::construct_at(end, std::ranges::iter_move(from));
+		last = end;
+	    }
+
+	    buffered_run(const buffered_run&) = delete;
+	    buffered_run& operator=(const buffered_run&) = delete;
+
+	    ~buffered_run()
+	    {
+		if constexpr(Forward)
+		    ::alg::move(first, last, out);
+		else
+		    ::alg::move_backwards(first, last, out);
+		std::destroy(storage, end);
+	    }
+
+	    T* const storage;
+	    T* first;
+	    T* last;
+
+	private:
+	    T* end;
+	    Iter& out;
+	};
+
+	// Merges [l, m) held in the buffer with [m, r) from the front. After
+	// min_gallop consecutive wins of one side it switches to galloping, which
+	// stays on while the gallops keep taking long stretches.
+	template<std::random_access_iterator Iter, typename T, typename Less>
+	void merge_low(Iter l, Iter m, Iter r, T* storage, Less& less, std::ptrdiff_t& gallop_after)
+	{
+	    auto out{l}, right{m};
+	    buffered_run<true, T, Iter> left(storage, l, m, out);
+	    auto& b{left.first};
+	    const auto be{left.last};
+
+	    while(b != be && right != r) {
+		std::ptrdiff_t wins1{}, wins2{};
+		while(b != be && right != r && std::max(wins1, wins2) < gallop_after)
+		    if(less(*right, *b)) {
+			*out++ = std::ranges::iter_move(right++);
+			++wins2;
+			wins1 = 0;
+		    }
+		    else {
+			*out++ = std::move(*b++);
+			++wins1;
+			wins2 = 0;
+		    }
+
+		for(bool galloping{true}; galloping && b != be && right != r;) {
+		    const auto taken1{gallop(b, be, [&] (auto& e) { return !less(*right, e); }) - b};
+		    out = ::alg::move(b, b + taken1, out).out;
+		    b += taken1;
+		    if(b == be)
+			break;
+		    *out++ = std::ranges::iter_move(right++);
+
+		    const auto next{gallop(right, r, [&] (auto&& e) { return less(e, *b); })};
+		    const auto taken2{next - right};
+		    out = ::alg::move(right, next, out).out;
+		    right = next;
+		    if(right == r)
+			break;
+		    *out++ = std::move(*b++);
+
+		    gallop_after = std::max<std::ptrdiff_t>(gallop_after - 1, 1);
+		    galloping = taken1 >= min_gallop || taken2 >= min_gallop;
+		}
+		gallop_after += 2;
+	    }
+	}
+
+	// merge_low mirrored: [m, r) is held in the buffer and the merge runs
+	// from the back
+	template<std::random_access_iterator Iter, typename T, typename Less>
+	void merge_high(Iter l, Iter m, Iter r, T* storage, Less& less, std::ptrdiff_t& gallop_after)
+	{
+	    auto out{r}, left{m};
+	    buffered_run<false, T, Iter> right(storage, m, r, out);
+	    const auto bb{right.first};
+	    auto& be{right.last};
+
+	    const auto rleft = [&] { return std::make_reverse_iterator(left); };
+	    const auto rbe = [&] { return std::make_reverse_iterator(be); };
+
+	    while(bb != be && left != l) {
+		std::ptrdiff_t wins1{}, wins2{};
+		while(bb != be && left != l && std::max(wins1, wins2) < gallop_after)
+		    if(less(*(be - 1), *(left - 1))) {
+			*--out = std::ranges::iter_move(--left);
+			++wins1;
+			wins2 = 0;
+		    }
+		    else {
+			*--out = std::move(*--be);
+			++wins2;
+			wins1 = 0;
+		    }
+
+		for(bool galloping{true}; galloping && bb != be && left != l;) {
+		    const auto taken1{gallop(rleft(), std::make_reverse_iterator(l),
+			[&] (auto&& e) { return less(*(be - 1), e); }) - rleft()};
+		    out = ::alg::move_backwards(left - taken1, left, out).out;
+		    left -= taken1;
+		    if(left == l)
+			break;
+		    *--out = std::move(*--be);
+
+		    const auto taken2{gallop(rbe(), std::make_reverse_iterator(bb),
+			[&] (auto& e) { return !less(e, *(left - 1)); }) - rbe()};
+		    out = ::alg::move_backwards(be - taken2, be, out).out;
+		    be -= taken2;
+		    if(be == bb)
+			break;
+		    *--out = std::ranges::iter_move(--left);
+
+		    gallop_after = std::max<std::ptrdiff_t>(gallop_after - 1, 1);
+		    galloping = taken1 >= min_gallop || taken2 >= min_gallop;
+		}
+		gallop_after += 2;
+	    }
+	}
+
+	// Merges the adjacent sorted runs [l, m) and [m, r). Elements already in
+	// place at either end are skipped first; if the shorter remaining run
+	// does not fit into the buffer, the longer one is split in half, the
+	// shorter one at the matching position, and a rotation leaves two
+	// smaller merges.
+	template<std::random_access_iterator Iter, typename Buffer, typename Less>
+	void merge_adjacent(Iter l, Iter m, Iter r, Buffer& buffer, Less& less, std::ptrdiff_t& gallop_after)
+	{
+	    if(l == m || m == r)
+		return;
+
+	    l = gallop(l, m, [&] (auto&& e) { return !less(*m, e); });
+	    if(l == m)
+		return;
+	    r = gallop(std::make_reverse_iterator(r), std::make_reverse_iterator(m),
+		[&] (auto&& e) { return !less(e, *(m - 1)); }).base();
+
+	    const auto n1{m - l}, n2{r - m};
+	    if(n1 <= n2 && n1 <= buffer.capacity())
+		return merge_low(l, m, r, buffer.data(), less, gallop_after);
+	    if(n2 <= buffer.capacity())
+		return merge_high(l, m, r, buffer.data(), less, gallop_after);
+
+	    Iter cut1, cut2;
+	    if(n1 >= n2) {
+		cut1 = l + n1 / 2;
+		cut2 = ::alg::partition_point(m, r, [&] (auto&& e) { return less(e, *cut1); });
+	    }
+	    else {
+		cut2 = m + n2 / 2;
+		cut1 = ::alg::partition_point(l, m, [&] (auto&& e) { return !less(*cut2, e); });
+	    }
+
+	    const auto mid{std::begin(::alg::rotate(cut1, m, cut2))};
+	    merge_adjacent(l, cut1, mid, buffer, less, gallop_after);
+	    merge_adjacent(mid, cut2, r, buffer, less, gallop_after);
+	}
+
+	// End of the natural run starting at first. A strictly descending run is
+	// reversed in place, equal elements would lose their order otherwise.
+	template<std::random_access_iterator Iter, typename Less>
+	auto natural_run(Iter first, Iter last, Less& less) -> Iter
+	{
+	    auto cur{first + 1};
+	    if(cur == last)
+		return last;
+
+	    if(less(*cur, *first)) {
+		while(++cur != last && less(*cur, *(cur - 1)));
+		::alg::reverse(first, cur);
+	    }
+	    else
+		while(++cur != last && !less(*cur, *(cur - 1)));
+	    return cur;
+	}
+
+	// Powersort priority of the boundary between the runs [s1, s1 + n1) and
+	// [s1 + n1, s1 + n1 + n2) of an n element range: the depth at which the
+	// midpoints of the runs fall on different sides of a bisection of [0, n)
+	[[nodiscard]] constexpr auto node_power(std::size_t s1, std::size_t n1, std::size_t n2, std::size_t n) -> int
+	{
+	    auto a{2 * s1 + n1}, b{a + n1 + n2};
+	    int power{};
+	    for(;;) {
+		++power;
+		if(a >= n) {
+		    a -= n;
+		    b -= n;
+		}
+		else if(b >= n)
+		    return power;
+		a <<= 1;
+		b <<= 1;
+	    }
+	}
+
+	// Powersort: natural runs, extended to stable_min_run by insertion sort,
+	// are pushed on a stack and merged as soon as the boundary below the top
+	// has a higher power than the one just found. This gives merges close to
+	// an optimal tree over the run lengths, so input made of k runs costs
+	// about n log k comparisons and presorted input a single pass.
+	template<std::random_access_iterator Iter, typename Comp, typename Proj, typename Alloc>
+	void stable_sort(Iter first, Iter last, Comp& f, Proj& p, const Alloc& alloc)
+	{
+	    struct run
+	    {
+		Iter first, last;
+		int power;
+	    };
+
+	    auto less{projected_less(f, p)};
+	    const auto n{last - first};
+	    if(n < stable_min_run) {
+		insertion_sort(first, last, less);
+		return;
+	    }
+
+	    auto end{natural_run(first, last, less)};
+	    if(end == last)
+		return;
+
+	    merge_buffer<std::iter_value_t<Iter>, Alloc> buffer(n / 2, alloc);
+	    std::ptrdiff_t gallop_after{min_gallop};
+	    std::vector<run> runs;
+
+	    const auto merge_top = [&] {
+		const auto top{runs.back()};
+		runs.pop_back();
+		merge_adjacent(runs.back().first, top.first, top.last, buffer, less, gallop_after);
+		runs.back().last = top.last;
+	    };
+
+	    for(auto begin{first};;) {
+		if(end - begin < stable_min_run) {
+		    end = begin + std::min(stable_min_run, last - begin);
+		    insertion_sort(begin, end, less);
+		}
+
+		int power{};
+		if(!runs.empty()) {
+		    const auto& below{runs.back()};
+		    power = node_power(static_cast<std::size_t>(below.first - first), static_cast<std::size_t>(below.last - below.first),
+			static_cast<std::size_t>(end - begin), static_cast<std::size_t>(n));
+		    while(std::size(runs) > 1 && runs.back().power > power)
+			merge_top();
+		}
+		runs.push_back({begin, end, power});
+
+		if((begin = end) == last)
+		    break;
+		end = natural_run(begin, last, less);
+	    }
+
+	    while(std::size(runs) > 1)
+		merge_top();
+	}
+
+
+	inline constexpr std::ptrdiff_t floyd_rivest_cutoff{600};
+
+	// Hoare partition of (first, last) that checks bounds instead of relying
+	// on sentinels. Returns l such that goes_left holds on (first, l) and
+	// fails on [l, last).
+	template<std::random_access_iterator Iter, typename Pred>
+	constexpr auto select_partition(Iter first, Iter last, Pred goes_left) -> Iter
+	{
+	    auto l{first}, r{last};
+	    for(;;) {
+		while(++l != r && goes_left(*l));
+		while(l != r && !goes_left(*--r));
+		if(l == r)
+		    return l;
+		std::ranges::iter_swap(l, r);
+	    }
+	}
+
+	// Floyd-Rivest selection. On large ranges the pivot is the element of
+	// matching rank in a sample of about n^(2/3) elements around nth, itself
+	// selected recursively, so a partition usually leaves only a sliver of
+	// the range around nth. Smaller ranges use a median of three. As in
+	// pdq_sort, a range that is not leftmost has a predecessor no greater
+	// than any of its elements, which lets runs of the minimum be skipped at
+	// once. Too many partitions that fail to halve the range hand it to
+	// pdq_sort.
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void floyd_rivest_select(Iter first, Iter nth, Iter last, Less& less, bool leftmost)
+	{
+	    using diff_t = std::iter_difference_t<Iter>;
+	    auto bad_allowed{static_cast<int>(std::bit_width(static_cast<std::size_t>(last - first)))};
+
+	    while(last - first > insertion_sort_threshold) {
+		const auto n{last - first};
+		auto pivot{first + n / 2};
+
+		if(n > floyd_rivest_cutoff && !std::is_constant_evaluated()) {
+		    const auto size{static_cast<double>(n)};
+		    const auto i{static_cast<double>(nth - first)};
+		    const auto z{std::log(size)};
+		    const auto s{0.5 * std::exp(2 * z / 3)};
+		    const auto sd{0.5 * std::sqrt(z * s * (size - s) / size) * (i < size / 2 ? -1 : 1)};
+		    const auto lo{std::clamp(static_cast<diff_t>(i - i * s / size + sd), diff_t{}, nth - first)};
+		    const auto hi{std::clamp(static_cast<diff_t>(i + (size - i) * s / size + sd) + 1, nth - first + 1, n)};
+		    floyd_rivest_select(first + lo, nth, first + hi, less, true);
+		    pivot = nth;
+		}
+		else
+		    sort3(first, pivot, last - 1, less);
+		std::ranges::iter_swap(first, pivot);
+
+		if(!leftmost && !less(*(first - 1), *first)) {
+		    first = select_partition(first, last, [&] (auto&& e) { return !less(*first, e); });
+		    if(nth < first)
+			return;
+		    continue;
+		}
+
+		const auto pivot_pos{select_partition(first, last, [&] (auto&& e) { return less(e, *first); }) - 1};
+		std::ranges::iter_swap(first, pivot_pos);
+		if(pivot_pos == nth)
+		    return;
+
+		if(nth < pivot_pos)
+		    last = pivot_pos;
+		else {
+		    first = pivot_pos + 1;
+		    leftmost = false;
+		}
+
+		if(2 * (last - first) > n && --bad_allowed == 0) {
+		    pdq_sort<false>(first, last, less, static_cast<int>(std::bit_width(static_cast<std::size_t>(last - first))), leftmost);
+		    return;
+		}
+	    }
+
+	    if(leftmost)
+		insertion_sort(first, last, less);
+	    else
+		unguarded_insertion_sort(first, last, less);
+	}
+
+	// Few elements wanted out of many: keep the smallest seen in a heap with
+	// the largest on top. Otherwise select the boundary and sort what is
+	// in front of it.
+	template<std::random_access_iterator Iter, typename Less>
+	constexpr void partial_sort(Iter first, Iter middle, Iter last, Less& less)
+	{
+	    const auto k{middle - first};
+	    if(k == 0)
+		return;
+
+	    if(k * 64 > last - first) {
+		if(middle != last)
+		    floyd_rivest_select(first, middle, last, less, true);
+		pdq_sort<false>(first, middle, less, static_cast<int>(std::bit_width(static_cast<std::size_t>(k))), true);
+		return;
+	    }
+
+	    for(auto i{k / 2}; i-- > 0;)
+		heap_sift_down(first, k, i, less);
+	    for(auto it{middle}; it != last; ++it)
+		if(less(*it, *first)) {
+		    std::ranges::iter_swap(it, first);
+		    heap_sift_down(first, k, std::iter_difference_t<Iter>{}, less);
+		}
+	    for(auto n{k}; n > 1; --n) {
+		std::ranges::iter_swap(first, first + (n - 1));
+		heap_sift_down(first, n - 1, std::iter_difference_t<Iter>{}, less);
+	    }
+	}
+
+    }
+
+    //************************* sort ****************************
+
+    template<std::random_access_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<Iter, Comp, Proj>
+    constexpr auto sort(Iter left, Sent right, Comp f = {}, Proj p = {}) -> Iter
+    {
+	auto last{std::ranges::next(left, right)};
+	detail::sort(std::move(left), last, f, p);
+	return last;
+    }
+
+    template<std::ranges::random_access_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+    constexpr auto sort(Range&& range, Comp f = {}, Proj p = {}) -> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::sort(std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
+    template<concepts::execution_policy Policy,
+	std::random_access_iterator Iter, std::sized_sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<Iter, Comp, Proj>
+    auto sort(Policy&&, Iter left, Sent right, Comp f = {}, Proj p = {}) -> Iter
+    {
+	const auto n{static_cast<std::size_t>(right - left)};
+	const auto chunks{concepts::parallel_execution_policy<Policy> ? detail::chunk_count(n) : 1};
+
+	if constexpr(detail::sample_sortable<Iter, Proj>)
+	    if(chunks > 1) {
+		detail::sample_sort(left, n, chunks, f, p);
+		return left + static_cast<std::iter_difference_t<Iter>>(n);
+	    }
+
+	return ::alg::sort(std::move(left), std::move(right), std::ref(f), std::ref(p));
+    }
+
+    template<concepts::execution_policy Policy,
+	std::ranges::random_access_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::ranges::sized_range<Range> && std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+    auto sort(Policy&& policy, Range&& range, Comp f = {}, Proj p = {}) -> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::sort(std::forward<Policy>(policy), std::begin(range), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
+
+    //********************** radix_sort *************************
+
+    // Stable ascending sort on integral, float or double keys. The scratch
+    // buffer of up to n elements comes from alloc, rebound to the value type.
+    template<std::random_access_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Proj = std::identity, typename Alloc = std::allocator<std::iter_value_t<Iter>>>
+    requires std::permutable<Iter> &&
+	std::indirectly_regular_unary_invocable<Proj, Iter> &&
+	detail::radix_key<std::remove_cvref_t<std::indirect_result_t<Proj&, Iter>>>
+    auto radix_sort(Iter left, Sent right, Proj p = {}, const Alloc& alloc = {}) -> Iter
+    {
+	auto last{std::ranges::next(left, right)};
+	detail::radix_sort(std::move(left), last, p, alloc);
+	return last;
+    }
+
+    template<std::ranges::random_access_range Range,
+	typename Proj = std::identity, typename Alloc = std::allocator<std::ranges::range_value_t<Range>>>
+    requires std::permutable<std::ranges::iterator_t<Range>> &&
+	std::indirectly_regular_unary_invocable<Proj, std::ranges::iterator_t<Range>> &&
+	detail::radix_key<std::remove_cvref_t<std::indirect_result_t<Proj&, std::ranges::iterator_t<Range>>>>
+    auto radix_sort(Range&& range, Proj p = {}, const Alloc& alloc = {}) -> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::radix_sort(std::begin(range), std::end(range), std::ref(p), alloc);
+    }
+
+
+
+    //********************** stable_sort ************************
+
+    // The buffer for merges, n / 2 elements at most, comes from alloc. If
+    // allocation fails, smaller buffers down to none are tried; merges that
+    // do not fit proceed by rotations.
+    template<std::random_access_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity,
+	typename Alloc = std::allocator<std::iter_value_t<Iter>>>
+    requires std::sortable<Iter, Comp, Proj>
+    auto stable_sort(Iter left, Sent right, Comp f = {}, Proj p = {}, const Alloc& alloc = {}) -> Iter
+    {
+	auto last{std::ranges::next(left, right)};
+	detail::stable_sort(std::move(left), last, f, p, alloc);
+	return last;
+    }
+
+    template<std::ranges::random_access_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity,
+	typename Alloc = std::allocator<std::ranges::range_value_t<Range>>>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+    auto stable_sort(Range&& range, Comp f = {}, Proj p = {}, const Alloc& alloc = {}) -> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::stable_sort(std::begin(range), std::end(range), std::ref(f), std::ref(p), alloc);
+    }
+
+
+    //********************** nth_element ************************
+
+    template<std::random_access_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<Iter, Comp, Proj>
+    constexpr auto nth_element(Iter left, Iter nth, Sent right, Comp f = {}, Proj p = {}) -> Iter
+    {
+	auto last{std::ranges::next(left, right)};
+	if(nth != last) {
+	    auto less{detail::projected_less(f, p)};
+	    detail::floyd_rivest_select(std::move(left), std::move(nth), last, less, true);
+	}
+	return last;
+    }
+
+    template<std::ranges::random_access_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+    constexpr auto nth_element(Range&& range, std::ranges::iterator_t<Range> nth, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::nth_element(std::begin(range), std::move(nth), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
+    //********************** partial_sort ***********************
+
+    template<std::random_access_iterator Iter, std::sentinel_for<Iter> Sent,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<Iter, Comp, Proj>
+    constexpr auto partial_sort(Iter left, Iter middle, Sent right, Comp f = {}, Proj p = {}) -> Iter
+    {
+	auto last{std::ranges::next(left, right)};
+	auto less{detail::projected_less(f, p)};
+	detail::partial_sort(std::move(left), std::move(middle), last, less);
+	return last;
+    }
+
+    template<std::ranges::random_access_range Range,
+	typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+    constexpr auto partial_sort(Range&& range, std::ranges::iterator_t<Range> middle, Comp f = {}, Proj p = {})
+	-> std::ranges::borrowed_iterator_t<Range>
+    {
+	return ::alg::partial_sort(std::begin(range), std::move(middle), std::end(range), std::ref(f), std::ref(p));
+    }
+
+
+    //******************* partial_sort_copy *********************
+
+    template<std::input_iterator Iter1, std::sentinel_for<Iter1> Sent1,
+	std::random_access_iterator Iter2, std::sentinel_for<Iter2> Sent2,
+	typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::indirectly_copyable<Iter1, Iter2> &&
+	std::sortable<Iter2, Comp, Proj2> &&
+	std::indirect_strict_weak_order<Comp, std::projected<Iter1, Proj1>, std::projected<Iter2, Proj2>>
+    constexpr auto partial_sort_copy(Iter1 left, Sent1 right, Iter2 rleft, Sent2 rright,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {})
+	-> std::ranges::partial_sort_copy_result<Iter1, Iter2>
+    {
+	// No slot to keep anything in, the heap below needs at least one
+	if(rleft == rright)
+	    return {std::ranges::next(std::move(left), std::move(right)), std::move(rleft)};
+
+	auto out{rleft};
+	for(; left != right && out != rright; ++left, ++out)
+	    *out = *left;
+
+	// Everything fit, sorting the copy beats any heap
+	if(left == right) {
+	    detail::sort(rleft, out, f, p2);
+	    return {std::move(left), std::move(out)};
+	}
+
+	using diff_t = std::iter_difference_t<Iter2>;
+	auto less{detail::projected_less(f, p2)};
+	const auto k{out - rleft};
+
+	for(auto i{k / 2}; i-- > 0;)
+	    detail::heap_sift_down(rleft, k, i, less);
+	for(; left != right; ++left)
+	    if(std::invoke(f, std::invoke(p1, *left), std::invoke(p2, *rleft))) {
+		*rleft = *left;
+		detail::heap_sift_down(rleft, k, diff_t{}, less);
+	    }
+	for(auto n{k}; n > 1; --n) {
+	    std::ranges::iter_swap(rleft, rleft + (n - 1));
+	    detail::heap_sift_down(rleft, n - 1, diff_t{}, less);
+	}
+
+	return {std::move(left), std::move(out)};
+    }
+
+    template<std::ranges::input_range Range1, std::ranges::random_access_range Range2,
+	typename Comp = std::ranges::less,
+	typename Proj1 = std::identity, typename Proj2 = std::identity>
+    requires std::indirectly_copyable<std::ranges::iterator_t<Range1>, std::ranges::iterator_t<Range2>> &&
+	std::sortable<std::ranges::iterator_t<Range2>, Comp, Proj2> &&
+	std::indirect_strict_weak_order<Comp,
+	    std::projected<std::ranges::iterator_t<Range1>, Proj1>,
+	    std::projected<std::ranges::iterator_t<Range2>, Proj2>>
+    constexpr auto partial_sort_copy(Range1&& range1, Range2&& range2,
+	    Comp f = {}, Proj1 p1 = {}, Proj2 p2 = {})
+	-> std::ranges::partial_sort_copy_result<
+	    std::ranges::borrowed_iterator_t<Range1>,
+	    std::ranges::borrowed_iterator_t<Range2>>
+    {
+	return ::alg::partial_sort_copy(std::begin(range1), std::end(range1), std::begin(range2), std::end(range2),
+	    std::ref(f), std::ref(p1), std::ref(p2));
+    }
+
+}
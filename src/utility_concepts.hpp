@@ -3,6 +3,9 @@
 #include <concepts>
 #include <compare>
 #include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
 
 
 namespace concepts 
@@ -41,4 +44,25 @@ namespace concepts
 	    std::projected<Iter2, Proj2>>;
 
 
+    template<typename Iter, typename Out>
+    concept bitwise_copyable = 
+	std::contiguous_iterator<Iter> &&
+	std::contiguous_iterator<Out> &&
+	std::same_as<std::iter_value_t<Iter>, std::iter_value_t<Out>> &&
+	std::is_trivially_copyable_v<std::iter_value_t<Iter>>;
+
+
+    template<typename Comp>
+    concept default_less = any_of<std::unwrap_reference_t<Comp>, std::ranges::less, std::less<>>;
+
+    template<typename Proj>
+    concept identity_projection = std::same_as<std::unwrap_reference_t<Proj>, std::identity>;
+
+
+    template<typename F, typename T>
+    concept span_generator = 
+	std::invocable<F&> &&
+	requires(F& f, std::span<T> s) { f.fill(s); };
+
+
 }
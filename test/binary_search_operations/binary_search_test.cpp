@@ -0,0 +1,65 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <array>
+#include <utility>
+#include <iterator>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "binary_search_operations.hpp"
+
+class binary_search_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 2, 2, 2, 4, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i * 10; };
+};
+
+
+TEST_F(binary_search_test, EmptyRange)
+{
+    EXPECT_FALSE(::alg::binary_search(std::begin(v), std::begin(v), 1));
+}
+
+TEST_F(binary_search_test, BasicTest)
+{
+    EXPECT_TRUE(::alg::binary_search(std::begin(v), std::end(v), 1));
+    EXPECT_TRUE(::alg::binary_search(std::begin(v), std::end(v), 2));
+    EXPECT_TRUE(::alg::binary_search(std::begin(v), std::end(v), 7));
+    EXPECT_FALSE(::alg::binary_search(std::begin(v), std::end(v), 3));
+    EXPECT_FALSE(::alg::binary_search(std::begin(v), std::end(v), 8));
+    EXPECT_FALSE(::alg::binary_search(std::begin(v), std::end(v), 0));
+
+    const std::vector<int> desc{7, 4, 2, 2, 1};
+    EXPECT_TRUE(::alg::binary_search(std::begin(desc), std::end(desc), 4, f));
+    EXPECT_FALSE(::alg::binary_search(std::begin(desc), std::end(desc), 5, f));
+}
+
+TEST_F(binary_search_test, RangeTest)
+{
+    EXPECT_TRUE(::alg::binary_search(v, 4));
+
+    const std::list<int> l(std::begin(v), std::end(v));
+    EXPECT_TRUE(::alg::binary_search(l, 2));
+    EXPECT_FALSE(::alg::binary_search(l, 5));
+}
+
+TEST_F(binary_search_test, ProjectionTest)
+{
+    EXPECT_TRUE(::alg::binary_search(v, 40, {}, p));
+    EXPECT_FALSE(::alg::binary_search(v, 4, {}, p));
+
+    using item = std::pair<std::string, int>;
+    const std::vector<item> items{{"a", 1}, {"b", 3}, {"c", 8}};
+    EXPECT_TRUE(::alg::binary_search(items, 8, {}, &item::second));
+}
+
+TEST_F(binary_search_test, ConstexprTest)
+{
+    constexpr std::array a{1, 3, 5, 7, 9};
+    static_assert(::alg::binary_search(a, 7));
+    static_assert(!::alg::binary_search(a, 8));
+}
@@ -0,0 +1,87 @@
+#include <vector>
+#include <string>
+#include <forward_list>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "binary_search_operations.hpp"
+
+class equal_range_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 2, 2, 2, 4, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i / 2; };
+};
+
+
+TEST_F(equal_range_test, EmptyRange)
+{
+    auto res = ::alg::equal_range(std::begin(v), std::begin(v), 2);
+
+    EXPECT_TRUE(res.empty());
+    EXPECT_EQ(std::begin(res), std::begin(v));
+}
+
+TEST_F(equal_range_test, BasicTest)
+{
+    auto res = ::alg::equal_range(std::begin(v), std::end(v), 2);
+
+    EXPECT_EQ(std::begin(res), std::begin(v) + 1);
+    EXPECT_EQ(std::end(res), std::begin(v) + 4);
+
+    res = ::alg::equal_range(std::begin(v), std::end(v), 3);
+
+    EXPECT_TRUE(res.empty());
+    EXPECT_EQ(std::begin(res), std::begin(v) + 4);
+
+    const std::vector<int> desc{7, 4, 2, 2, 1};
+    auto dres = ::alg::equal_range(std::begin(desc), std::end(desc), 2, f);
+
+    EXPECT_EQ(std::size(dres), 2);
+}
+
+TEST_F(equal_range_test, RangeTest)
+{
+    auto res = ::alg::equal_range(v, 7);
+
+    EXPECT_EQ(std::begin(res), std::begin(v) + 5);
+    EXPECT_EQ(std::end(res), std::end(v));
+
+    const std::forward_list<int> l(std::begin(v), std::end(v));
+    EXPECT_EQ(std::ranges::distance(::alg::equal_range(l, 2)), 3);
+    static_assert(std::same_as<decltype(::alg::equal_range(std::vector<int>{}, 1)), std::ranges::dangling>);
+}
+
+TEST_F(equal_range_test, ProjectionTest)
+{
+    auto res = ::alg::equal_range(v, 1, {}, p);
+
+    EXPECT_EQ(std::begin(res), std::begin(v) + 1);
+    EXPECT_EQ(std::end(res), std::begin(v) + 4);
+
+    using item = std::pair<int, std::string>;
+    const std::vector<item> items{{1, "a"}, {3, "b"}, {3, "c"}, {8, "d"}};
+    EXPECT_EQ(std::size(::alg::equal_range(items, 3, {}, &item::first)), 2);
+}
+
+TEST_F(equal_range_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    std::vector<int> keys(50000);
+    for(auto& key : keys)
+	key = static_cast<int>(gen() % 5000);
+    std::ranges::sort(keys);
+
+    for(int x{-1}; x != 5001; ++x) {
+	const auto res = ::alg::equal_range(keys, x);
+	const auto expected = std::ranges::equal_range(keys, x);
+	ASSERT_EQ(std::begin(res), std::begin(expected));
+	ASSERT_EQ(std::end(res), std::end(expected));
+    }
+}
@@ -0,0 +1,78 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <array>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "binary_search_operations.hpp"
+
+class lower_bound_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 2, 2, 2, 4, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i * 10; };
+};
+
+
+TEST_F(lower_bound_test, EmptyRange)
+{
+    auto res = ::alg::lower_bound(std::begin(v), std::begin(v), 2);
+
+    EXPECT_EQ(res, std::begin(v));
+}
+
+TEST_F(lower_bound_test, BasicTest)
+{
+    EXPECT_EQ(::alg::lower_bound(std::begin(v), std::end(v), 2), std::begin(v) + 1);
+    EXPECT_EQ(::alg::lower_bound(std::begin(v), std::end(v), 3), std::begin(v) + 4);
+    EXPECT_EQ(::alg::lower_bound(std::begin(v), std::end(v), 0), std::begin(v));
+    EXPECT_EQ(::alg::lower_bound(std::begin(v), std::end(v), 8), std::end(v));
+
+    const std::vector<int> desc{7, 4, 2, 2, 1};
+    EXPECT_EQ(::alg::lower_bound(std::begin(desc), std::end(desc), 2, f), std::begin(desc) + 2);
+}
+
+TEST_F(lower_bound_test, RangeTest)
+{
+    EXPECT_EQ(::alg::lower_bound(v, 4), std::begin(v) + 4);
+
+    const std::list<int> l(std::begin(v), std::end(v));
+    EXPECT_EQ(::alg::lower_bound(l, 2), std::next(std::begin(l)));
+    EXPECT_EQ(::alg::lower_bound(l, 7), std::prev(std::end(l)));
+}
+
+TEST_F(lower_bound_test, ProjectionTest)
+{
+    EXPECT_EQ(::alg::lower_bound(v, 20, {}, p), std::begin(v) + 1);
+    EXPECT_EQ(::alg::lower_bound(v, 21, {}, p), std::begin(v) + 4);
+
+    using item = std::pair<int, std::string>;
+    const std::vector<item> items{{1, "a"}, {3, "b"}, {3, "c"}, {8, "d"}};
+    EXPECT_EQ(::alg::lower_bound(items, 3, {}, &item::first)->second, "b");
+}
+
+TEST_F(lower_bound_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    std::vector<unsigned> keys(100000);
+    for(auto& key : keys)
+	key = static_cast<unsigned>(gen() % 300000);
+    std::ranges::sort(keys);
+
+    for(unsigned x{}; x < 300010; x += 7)
+	ASSERT_EQ(::alg::lower_bound(keys, x), std::ranges::lower_bound(keys, x));
+}
+
+TEST_F(lower_bound_test, ConstexprTest)
+{
+    constexpr std::array a{1, 3, 5, 7, 9};
+    static_assert(*::alg::lower_bound(a, 4) == 5);
+    static_assert(::alg::lower_bound(a, 10) == std::end(a));
+}
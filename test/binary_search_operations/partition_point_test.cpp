@@ -0,0 +1,72 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "binary_search_operations.hpp"
+
+class partition_point_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{2, 4, 6, 1, 3, 5, 7};
+    const std::function<bool(int)> even = [] (int i) { return i % 2 == 0; };
+    const std::function<int(int)> p = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(partition_point_test, EmptyRange)
+{
+    auto res = ::alg::partition_point(std::begin(v), std::begin(v), even);
+
+    EXPECT_EQ(res, std::begin(v));
+}
+
+TEST_F(partition_point_test, BasicTest)
+{
+    auto res = ::alg::partition_point(std::begin(v), std::end(v), even);
+
+    EXPECT_EQ(res, std::begin(v) + 3);
+
+    res = ::alg::partition_point(std::begin(v), std::end(v), [] (int) { return true; });
+
+    EXPECT_EQ(res, std::end(v));
+
+    res = ::alg::partition_point(std::begin(v), std::end(v), [] (int) { return false; });
+
+    EXPECT_EQ(res, std::begin(v));
+}
+
+TEST_F(partition_point_test, RangeTest)
+{
+    EXPECT_EQ(::alg::partition_point(v, even), std::begin(v) + 3);
+
+    const std::list<int> l(std::begin(v), std::end(v));
+    EXPECT_EQ(::alg::partition_point(l, even), std::next(std::begin(l), 3));
+}
+
+TEST_F(partition_point_test, ProjectionTest)
+{
+    const std::vector<int> odd_first{1, 3, 2, 4};
+    EXPECT_EQ(::alg::partition_point(odd_first, even, p), std::begin(odd_first) + 2);
+
+    using item = std::pair<int, std::string>;
+    const std::vector<item> items{{1, "a"}, {3, "b"}, {8, "c"}};
+    EXPECT_EQ(::alg::partition_point(items, [] (int i) { return i < 5; }, &item::first)->second, "c");
+}
+
+TEST_F(partition_point_test, LargeTest)
+{
+    std::vector<int> keys(12345);
+    for(int i{}; i != 12345; ++i)
+	keys[i] = i * 3;
+
+    for(int bound{-1}; bound < 12345 * 3 + 2; bound += 5) {
+	const auto below = [bound] (int key) { return key < bound; };
+	ASSERT_EQ(::alg::partition_point(keys, below), std::ranges::partition_point(keys, below));
+    }
+}
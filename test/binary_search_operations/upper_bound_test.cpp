@@ -0,0 +1,67 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "binary_search_operations.hpp"
+
+class upper_bound_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 2, 2, 2, 4, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i * 10; };
+};
+
+
+TEST_F(upper_bound_test, EmptyRange)
+{
+    auto res = ::alg::upper_bound(std::begin(v), std::begin(v), 2);
+
+    EXPECT_EQ(res, std::begin(v));
+}
+
+TEST_F(upper_bound_test, BasicTest)
+{
+    EXPECT_EQ(::alg::upper_bound(std::begin(v), std::end(v), 2), std::begin(v) + 4);
+    EXPECT_EQ(::alg::upper_bound(std::begin(v), std::end(v), 0), std::begin(v));
+    EXPECT_EQ(::alg::upper_bound(std::begin(v), std::end(v), 7), std::end(v));
+
+    const std::vector<int> desc{7, 4, 2, 2, 1};
+    EXPECT_EQ(::alg::upper_bound(std::begin(desc), std::end(desc), 2, f), std::begin(desc) + 4);
+}
+
+TEST_F(upper_bound_test, RangeTest)
+{
+    EXPECT_EQ(::alg::upper_bound(v, 1), std::begin(v) + 1);
+
+    const std::list<int> l(std::begin(v), std::end(v));
+    EXPECT_EQ(::alg::upper_bound(l, 2), std::next(std::begin(l), 4));
+}
+
+TEST_F(upper_bound_test, ProjectionTest)
+{
+    EXPECT_EQ(::alg::upper_bound(v, 20, {}, p), std::begin(v) + 4);
+
+    using item = std::pair<int, std::string>;
+    const std::vector<item> items{{1, "a"}, {3, "b"}, {3, "c"}, {8, "d"}};
+    EXPECT_EQ(::alg::upper_bound(items, 3, {}, &item::first)->second, "d");
+}
+
+TEST_F(upper_bound_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    std::vector<double> keys(100000);
+    for(auto& key : keys)
+	key = static_cast<double>(gen() % 50000) / 4;
+    std::ranges::sort(keys);
+
+    for(double x{-1}; x < 12600; x += 0.75)
+	ASSERT_EQ(::alg::upper_bound(keys, x), std::ranges::upper_bound(keys, x));
+}
@@ -0,0 +1,93 @@
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "compressed_set.hpp"
+
+class compressed_set_test : public ::testing::Test
+{
+protected:
+    // Sparse values, a dense chunk that needs a bitmap and a chunk of long runs
+    static auto mixed_values() -> std::vector<std::uint32_t>
+    {
+	std::vector<std::uint32_t> values{3, 70000, 1u << 31, 0xffffffff};
+	for(std::uint32_t i{}; i != 10000; ++i)
+	    values.push_back((5u << 16) + i * 3);
+	for(std::uint32_t i{}; i != 20000; ++i)
+	    values.push_back((9u << 16) + i);
+	std::ranges::sort(values);
+	return values;
+    }
+};
+
+
+TEST_F(compressed_set_test, EmptyTest)
+{
+    const alg::compressed_set set;
+
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(std::size(set), 0);
+    EXPECT_EQ(std::begin(set), std::end(set));
+    EXPECT_FALSE(set.contains(0));
+    EXPECT_EQ(alg::compressed_set::iterator{}, alg::compressed_set::iterator{});
+    EXPECT_NE(alg::compressed_set::iterator{}, std::end(set));
+
+    static_assert(std::forward_iterator<alg::compressed_set::iterator>);
+    static_assert(std::same_as<std::iterator_traits<alg::compressed_set::iterator>::iterator_category, std::input_iterator_tag>);
+}
+
+TEST_F(compressed_set_test, InsertTest)
+{
+    alg::compressed_set set{7, 1, 7, 70000, 3};
+
+    EXPECT_EQ(std::size(set), 4);
+    EXPECT_TRUE(set.contains(7));
+    EXPECT_TRUE(set.contains(70000));
+    EXPECT_FALSE(set.contains(2));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(2));
+    EXPECT_EQ((std::vector<std::uint32_t>(std::begin(set), std::end(set))), (std::vector<std::uint32_t>{1, 2, 3, 7, 70000}));
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+}
+
+TEST_F(compressed_set_test, LayoutTest)
+{
+    const auto values{mixed_values()};
+    alg::compressed_set set;
+    std::ranges::copy(values, std::back_inserter(set));
+
+    EXPECT_EQ(std::size(set), std::size(values));
+    EXPECT_TRUE(std::ranges::equal(set, values));
+
+    const alg::compressed_set shuffled(std::rbegin(values), std::rend(values));
+    EXPECT_EQ(set, shuffled);
+
+    const auto before{set.memory_usage()};
+    set.optimize();
+
+    EXPECT_LT(set.memory_usage(), before);
+    EXPECT_TRUE(std::ranges::equal(set, values));
+    EXPECT_TRUE(set.contains((9u << 16) + 19999));
+    EXPECT_FALSE(set.contains((9u << 16) + 20000));
+
+    EXPECT_TRUE(set.insert((9u << 16) + 30000));
+    EXPECT_EQ(std::size(set), std::size(values) + 1);
+    EXPECT_TRUE(set.contains((9u << 16) + 30000));
+    EXPECT_TRUE(set.contains((9u << 16) + 5));
+}
+
+TEST_F(compressed_set_test, MemoryTest)
+{
+    alg::compressed_set set;
+    for(std::uint32_t i{}; i != 1 << 20; ++i)
+	set.push_back(i);
+    set.optimize();
+
+    EXPECT_EQ(std::size(set), 1 << 20);
+    EXPECT_LT(set.memory_usage() * 20, (1u << 20) * sizeof(std::uint32_t));
+}
@@ -0,0 +1,147 @@
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "compressed_set.hpp"
+
+class compressed_set_operations_test : public ::testing::Test
+{
+protected:
+    static auto make(std::uint32_t step, std::uint32_t count, std::uint32_t offset) -> std::vector<std::uint32_t>
+    {
+	std::vector<std::uint32_t> values;
+	for(std::uint32_t i{}; i != count; ++i)
+	    values.push_back(offset + i * step);
+	return values;
+    }
+
+    void SetUp() override
+    {
+	// Every pairing of array, bitmap and run chunks shows up somewhere
+	for(auto part : {make(2, 30000, 0), make(97, 500, 1u << 16), make(1, 9000, 3u << 16), make(5, 2000, 7u << 16)})
+	    a.insert(std::end(a), std::begin(part), std::end(part));
+	for(auto part : {make(3, 20000, 0), make(1, 12000, 1u << 16), make(89, 600, 3u << 16), make(1, 100, 9u << 16)})
+	    b.insert(std::end(b), std::begin(part), std::end(part));
+
+	sa = alg::compressed_set(std::begin(a), std::end(a));
+	sb = alg::compressed_set(std::begin(b), std::end(b));
+	ra = sa;
+	rb = sb;
+	ra.optimize();
+	rb.optimize();
+    }
+
+    std::vector<std::uint32_t> a, b;
+    alg::compressed_set sa, sb, ra, rb;
+};
+
+
+TEST_F(compressed_set_operations_test, UnionTest)
+{
+    std::vector<std::uint32_t> expected;
+    std::ranges::set_union(a, b, std::back_inserter(expected));
+
+    for(const auto* x : {&sa, &ra})
+	for(const auto* y : {&sb, &rb}) {
+	    alg::compressed_set out;
+	    auto res = alg::set_union(*x, *y, alg::compressed_inserter(out));
+
+	    EXPECT_EQ(res.in1, std::end(*x));
+	    EXPECT_EQ(res.in2, std::end(*y));
+	    EXPECT_TRUE(std::ranges::equal(out, expected));
+	}
+}
+
+TEST_F(compressed_set_operations_test, IntersectionTest)
+{
+    std::vector<std::uint32_t> expected;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+
+    for(const auto* x : {&sa, &ra})
+	for(const auto* y : {&sb, &rb}) {
+	    alg::compressed_set out;
+	    alg::set_intersection(*x, *y, alg::compressed_inserter(out));
+
+	    EXPECT_TRUE(std::ranges::equal(out, expected));
+	}
+
+    alg::compressed_set out{5, 1u << 30};
+    alg::set_intersection(sa, sb, alg::compressed_inserter(out));
+    expected.push_back(5);
+    expected.push_back(1u << 30);
+
+    EXPECT_EQ(out, alg::compressed_set(std::begin(expected), std::end(expected)));
+}
+
+TEST_F(compressed_set_operations_test, DifferenceTest)
+{
+    std::vector<std::uint32_t> expected;
+    std::ranges::set_difference(a, b, std::back_inserter(expected));
+
+    for(const auto* x : {&sa, &ra})
+	for(const auto* y : {&sb, &rb}) {
+	    alg::compressed_set out;
+	    auto res = alg::set_difference(*x, *y, alg::compressed_inserter(out));
+
+	    EXPECT_EQ(res.in, std::end(*x));
+	    EXPECT_TRUE(std::ranges::equal(out, expected));
+	}
+}
+
+TEST_F(compressed_set_operations_test, IncludesTest)
+{
+    const auto common{sa & sb};
+    const auto optimized{[&] { auto set{common}; set.optimize(); return set; }()};
+
+    for(const auto* x : {&sa, &ra, &sb, &rb}) {
+	EXPECT_TRUE(alg::includes(*x, common));
+	EXPECT_TRUE(alg::includes(*x, optimized));
+    }
+    EXPECT_FALSE(alg::includes(sa, sb));
+    EXPECT_FALSE(alg::includes(rb, ra));
+    EXPECT_FALSE(alg::includes(common, alg::compressed_set{(1u << 16) + 1}));
+    EXPECT_TRUE(alg::includes(sa, alg::compressed_set{}));
+}
+
+TEST_F(compressed_set_operations_test, MixedTest)
+{
+    std::vector<std::uint32_t> expected, out;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+
+    alg::set_intersection(sa, b, std::back_inserter(out));
+    EXPECT_EQ(out, expected);
+
+    alg::compressed_set set;
+    alg::set_intersection(a, rb, std::back_inserter(set));
+    EXPECT_TRUE(std::ranges::equal(set, expected));
+    EXPECT_EQ(alg::set_intersection_size(sa, sb), std::size(expected));
+
+    set.clear();
+    alg::set_intersection(sa, sb, std::back_inserter(set));
+    EXPECT_TRUE(std::ranges::equal(set, expected));
+}
+
+TEST_F(compressed_set_operations_test, ChunkwiseTest)
+{
+    // Whole chunks are carried over with their layout, pushing the values
+    // one by one would turn the single run into a bitmap
+    alg::compressed_set dense;
+    for(std::uint32_t i{}; i != 20000; ++i)
+	dense.push_back(i);
+    dense.optimize();
+
+    alg::compressed_set out;
+    alg::set_union(dense, alg::compressed_set{}, alg::compressed_inserter(out));
+
+    EXPECT_EQ(out, dense);
+    EXPECT_EQ(out.memory_usage(), dense.memory_usage());
+
+    alg::compressed_set pushed;
+    alg::set_union(dense, alg::compressed_set{}, std::back_inserter(pushed));
+
+    EXPECT_EQ(pushed, dense);
+    EXPECT_GT(pushed.memory_usage(), dense.memory_usage());
+}
@@ -0,0 +1,54 @@
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "execution.hpp"
+
+class thread_pool_test : public ::testing::Test
+{
+protected:
+    alg::thread_pool pool{3};
+};
+
+
+TEST_F(thread_pool_test, EmptyRun)
+{
+    int calls{};
+    pool.run(0, [&] (std::size_t) { ++calls; });
+
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(pool.concurrency(), 4);
+}
+
+TEST_F(thread_pool_test, BasicTest)
+{
+    std::vector<int> v(1000);
+    pool.run(std::size(v), [&] (std::size_t i) { v[i] = static_cast<int>(i) * 2; });
+
+    for(std::size_t i{}; i != std::size(v); ++i)
+	EXPECT_EQ(v[i], static_cast<int>(i) * 2);
+}
+
+TEST_F(thread_pool_test, NestedTest)
+{
+    std::atomic<int> calls{};
+    pool.run(8, [&] (std::size_t) {
+	pool.run(8, [&] (std::size_t) { ++calls; });
+    });
+
+    EXPECT_EQ(calls, 64);
+}
+
+TEST_F(thread_pool_test, ExceptionTest)
+{
+    std::atomic<int> calls{};
+    EXPECT_THROW(pool.run(16, [&] (std::size_t i) {
+	++calls;
+	if(i == 5)
+	    throw std::runtime_error{"task failed"};
+    }), std::runtime_error);
+
+    EXPECT_EQ(calls, 16);
+}
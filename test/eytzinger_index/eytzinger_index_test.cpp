@@ -0,0 +1,105 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <random>
+#include <utility>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "eytzinger_index.hpp"
+
+class eytzinger_index_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 2, 2, 2, 4, 7, 9, 9, 12};
+};
+
+
+TEST_F(eytzinger_index_test, EmptyTest)
+{
+    const ::alg::eytzinger_index<int> index;
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(std::size(index), 0);
+    EXPECT_EQ(index.lower_bound(3), 0);
+    EXPECT_EQ(index.upper_bound(3), 0);
+    EXPECT_FALSE(index.contains(3));
+
+    const ::alg::eytzinger_index empty(std::begin(v), std::begin(v));
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.lower_bound(1), 0);
+}
+
+TEST_F(eytzinger_index_test, BasicTest)
+{
+    const ::alg::eytzinger_index index(std::begin(v), std::end(v));
+
+    EXPECT_EQ(std::size(index), std::size(v));
+    for(int x{-1}; x != 14; ++x) {
+	EXPECT_EQ(index.lower_bound(x), std::ranges::lower_bound(v, x) - std::begin(v)) << x;
+	EXPECT_EQ(index.upper_bound(x), std::ranges::upper_bound(v, x) - std::begin(v)) << x;
+	EXPECT_EQ(index.contains(x), std::ranges::binary_search(v, x)) << x;
+    }
+
+    const std::vector<int> desc(std::rbegin(v), std::rend(v));
+    const ::alg::eytzinger_index rindex(desc, std::ranges::greater{});
+
+    static_assert(std::same_as<decltype(rindex)::key_compare, std::ranges::greater>);
+
+    EXPECT_EQ(rindex.lower_bound(9), 1);
+    EXPECT_EQ(rindex.upper_bound(2), 8);
+    EXPECT_EQ(rindex.lower_bound(0), std::size(desc));
+}
+
+TEST_F(eytzinger_index_test, RangeTest)
+{
+    const std::list<int> l(std::begin(v), std::end(v));
+    const ::alg::eytzinger_index index(l);
+
+    EXPECT_EQ(index.lower_bound(2), 1);
+    EXPECT_EQ(index.upper_bound(2), 4);
+    EXPECT_EQ(index.lower_bound(13), std::size(l));
+    EXPECT_TRUE(index.contains(12));
+}
+
+TEST_F(eytzinger_index_test, ProjectionTest)
+{
+    using item = std::pair<std::string, int>;
+    const std::vector<item> items{{"a", 2}, {"b", 3}, {"c", 3}, {"d", 10}};
+    const ::alg::eytzinger_index index(items, {}, &item::second);
+
+    static_assert(std::same_as<decltype(index)::key_type, int>);
+    EXPECT_EQ(items[index.lower_bound(3)].first, "b");
+    EXPECT_EQ(items[index.upper_bound(3)].first, "d");
+    EXPECT_EQ(index.lower_bound(11), std::size(items));
+
+    const ::alg::eytzinger_index<std::string> names(items, {}, &item::first);
+
+    EXPECT_EQ(names.lower_bound("bb"), 2);
+    EXPECT_TRUE(names.contains("d"));
+}
+
+TEST_F(eytzinger_index_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    for(std::size_t n : {1, 2, 3, 15, 16, 17, 1000, 65535, 65536, 100001}) {
+	std::vector<std::uint64_t> keys(n);
+	for(auto& key : keys)
+	    key = gen() % (3 * n);
+	std::ranges::sort(keys);
+
+	const ::alg::eytzinger_index index(keys);
+
+	ASSERT_EQ(std::size(index), n);
+	for(int probe{}; probe != 2000; ++probe) {
+	    const std::uint64_t x{gen() % (3 * n + 2)};
+	    ASSERT_EQ(index.lower_bound(x), std::ranges::lower_bound(keys, x) - std::begin(keys));
+	    ASSERT_EQ(index.upper_bound(x), std::ranges::upper_bound(keys, x) - std::begin(keys));
+	}
+    }
+}
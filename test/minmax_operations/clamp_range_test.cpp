@@ -0,0 +1,89 @@
+#include <vector>
+#include <list>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "minmax_operations.hpp"
+
+class clamp_range_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v{10, 3, 6, 15, 7};
+    std::list<int> l{10, 3, 6, 15, 7};
+    std::vector<int> out{};
+    const std::function<bool(int, int)> pred = [] (int i, int j) { return i > j; };
+    const std::function<int(int)> p = [] (int i) { return i % 4; };
+};
+
+TEST_F(clamp_range_test, EmptyRange)
+{
+    auto res = alg::clamp_range(std::begin(v), std::begin(v), 5, 7);
+
+    EXPECT_EQ(res, std::begin(v));
+    EXPECT_EQ(v, (std::vector{10, 3, 6, 15, 7}));
+
+    auto cres = alg::clamp_range_copy(std::begin(v), std::begin(v), std::back_inserter(out), 5, 7);
+
+    EXPECT_EQ(cres.in, std::begin(v));
+    EXPECT_TRUE(out.empty());
+}
+
+TEST_F(clamp_range_test, BasicTest)
+{
+    auto res = alg::clamp_range(std::begin(v), std::end(v), 5, 7);
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{7, 5, 6, 7, 7}));
+
+    auto lres = alg::clamp_range(std::begin(l), std::end(l), 7, 5, pred);
+
+    EXPECT_EQ(lres, std::end(l));
+    EXPECT_EQ(l, (std::list{7, 5, 6, 7, 7}));
+}
+
+TEST_F(clamp_range_test, RangeTest)
+{
+    auto cres = alg::clamp_range_copy(l, std::back_inserter(out), 5, 7);
+
+    EXPECT_EQ(cres.in, std::end(l));
+    EXPECT_EQ(out, (std::vector{7, 5, 6, 7, 7}));
+
+    std::vector<int> dst(5);
+    auto vres = alg::clamp_range_copy(v, std::begin(dst), 5, 7);
+
+    EXPECT_EQ(vres.in, std::end(v));
+    EXPECT_EQ(vres.out, std::end(dst));
+    EXPECT_EQ(dst, (std::vector{7, 5, 6, 7, 7}));
+
+    alg::clamp_range(v, 5, 7);
+
+    EXPECT_EQ(v, (std::vector{7, 5, 6, 7, 7}));
+}
+
+TEST_F(clamp_range_test, ProjectionTest)
+{
+    alg::clamp_range(v, 5, 6, {}, p);
+
+    EXPECT_EQ(v, (std::vector{10, 6, 6, 6, 6}));
+
+    alg::clamp_range_copy(l, std::back_inserter(out), 6, 5, pred, p);
+
+    EXPECT_EQ(out, (std::vector{10, 6, 6, 6, 6}));
+}
+
+TEST_F(clamp_range_test, FloatingPointTest)
+{
+    const auto nan{std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> d{-1.5, nan, 0.5, 2.5};
+
+    alg::clamp_range(d, 0.0, 1.0);
+
+    EXPECT_EQ(d[0], 0.0);
+    EXPECT_TRUE(std::isnan(d[1]));
+    EXPECT_EQ(d[2], 0.5);
+    EXPECT_EQ(d[3], 1.0);
+}
@@ -12,6 +12,7 @@ protected:
     const std::vector<int> v{-1, -4, -3, -7, -5};
     const std::function<bool(int, int)> pred = [] (int i, int j) { return i > j; };
     const std::function<int(int)> p = [] (int i) { return i % 3; };
+    const std::function<bool(int, int)> less = std::ranges::less{};
 };
 
 TEST_F(min_element_test, EmptyRange)
@@ -36,3 +37,30 @@ TEST_F(min_element_test, ProjectionTest)
     EXPECT_EQ(alg::min_element(v, {}, p), std::begin(v) + 4);
     EXPECT_EQ(alg::min_element(v, pred, p), std::begin(v) + 2);
 }
+
+TEST_F(min_element_test, LaneTest)
+{
+    std::vector<int> big(1000);
+    for(int i{}; i != 1000; ++i)
+	big[i] = (i * 7919) % 101 - 50;
+
+    EXPECT_EQ(alg::min_element(big), alg::min_element(big, less));
+    EXPECT_EQ(alg::min_element(std::begin(big), std::begin(big) + 40), alg::min_element(std::begin(big), std::begin(big) + 40, less));
+
+    big[5] = big[500] = big[997] = -1000;
+
+    EXPECT_EQ(alg::min_element(big), std::begin(big) + 997);
+    EXPECT_EQ(alg::min_element(big), alg::min_element(big, less));
+}
+
+TEST_F(min_element_test, ParallelTest)
+{
+    std::vector<int> big(200000);
+    for(int i{}; i != 200000; ++i)
+	big[i] = (i * 7919) % 1009;
+
+    EXPECT_EQ(alg::min_element(alg::execution::par, big), alg::min_element(big));
+    EXPECT_EQ(alg::min_element(alg::execution::par, big, {}, p), alg::min_element(big, {}, p));
+    EXPECT_EQ(alg::min_element(alg::execution::par, std::begin(big), std::end(big), pred), alg::min_element(big, pred));
+    EXPECT_EQ(alg::min_element(alg::execution::seq, big), alg::min_element(big));
+}
@@ -0,0 +1,75 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "minmax_operations.hpp"
+
+class min_k_elements_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{1, 4, 0, 7, 5};
+    std::vector<int> out{};
+    const std::function<bool(int, int)> pred = [] (int i, int j) { return i > j; };
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+};
+
+TEST_F(min_k_elements_test, EmptyRange)
+{
+    auto res = alg::min_k_elements(std::begin(v), std::begin(v), 3, std::back_inserter(out));
+
+    EXPECT_EQ(res.in, std::begin(v));
+    EXPECT_TRUE(out.empty());
+
+    res = alg::min_k_elements(std::begin(v), std::end(v), 0, std::back_inserter(out));
+
+    EXPECT_EQ(res.in, std::end(v));
+    EXPECT_TRUE(out.empty());
+}
+
+TEST_F(min_k_elements_test, BasicTest)
+{
+    auto res = alg::min_k_elements(std::begin(v), std::end(v), 3, std::back_inserter(out));
+
+    EXPECT_EQ(res.in, std::end(v));
+    EXPECT_EQ(out, (std::vector{0, 1, 4}));
+
+    out.clear();
+    alg::min_k_elements(std::begin(v), std::end(v), 3, std::back_inserter(out), pred);
+
+    EXPECT_EQ(out, (std::vector{7, 5, 4}));
+
+    out.clear();
+    alg::min_k_elements(std::begin(v), std::end(v), 10, std::back_inserter(out));
+
+    EXPECT_EQ(std::size(out), 5);
+}
+
+TEST_F(min_k_elements_test, RangeTest)
+{
+    std::istringstream stream{"1 4 0 7 5"};
+    alg::min_k_elements(std::views::istream<int>(stream), 3, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{0, 1, 4}));
+}
+
+TEST_F(min_k_elements_test, ProjectionTest)
+{
+    alg::min_k_elements(v, 3, std::back_inserter(out), {}, p);
+
+    EXPECT_EQ(out, (std::vector{0, 1, 4}));
+}
+
+TEST_F(min_k_elements_test, StabilityTest)
+{
+    const std::vector<std::pair<int, char>> t{{1, 'a'}, {2, 'b'}, {1, 'c'}, {2, 'd'}, {1, 'e'}, {2, 'f'}};
+    std::vector<std::pair<int, char>> res;
+
+    alg::min_k_elements(t, 4, std::back_inserter(res), {}, &std::pair<int, char>::first);
+
+    EXPECT_EQ(res, (std::vector<std::pair<int, char>>{{1, 'a'}, {1, 'c'}, {1, 'e'}, {2, 'b'}}));
+}
@@ -65,3 +65,63 @@ TEST_F(minmax_element_test, ProjectionTest)
     EXPECT_EQ(res.min, std::begin(v) + 4);
     EXPECT_EQ(res.max, std::begin(v) + 2);
 }
+
+TEST_F(minmax_element_test, TieTest)
+{
+    const std::vector<int> t{3, 1, 5, 1, 5, 2, 5};
+    auto res = alg::minmax_element(t);
+
+    EXPECT_EQ(res.min, std::begin(t) + 1);
+    EXPECT_EQ(res.max, std::begin(t) + 6);
+
+    res = alg::minmax_element(std::begin(t), std::end(t) - 1);
+
+    EXPECT_EQ(res.min, std::begin(t) + 1);
+    EXPECT_EQ(res.max, std::begin(t) + 4);
+
+    auto iota = std::views::iota(0, 9);
+    auto ires = alg::minmax_element(iota, {}, p);
+
+    EXPECT_EQ(*ires.min, 0);
+    EXPECT_EQ(*ires.max, 8);
+}
+
+TEST_F(minmax_element_test, ComparisonCountTest)
+{
+    std::vector<int> big(101);
+    for(int i{}; i != 101; ++i)
+	big[i] = (i * 37) % 101;
+
+    int projections{}, comparisons{};
+    auto res = alg::minmax_element(big,
+	    [&] (int a, int b) { ++comparisons; return a < b; },
+	    [&] (int a) { ++projections; return a; });
+
+    EXPECT_EQ(*res.min, 0);
+    EXPECT_EQ(*res.max, 100);
+    EXPECT_EQ(projections, 101);
+    EXPECT_EQ(comparisons, 150);
+}
+
+TEST_F(minmax_element_test, ParallelTest)
+{
+    std::vector<int> big(200000);
+    for(int i{}; i != 200000; ++i)
+	big[i] = (i * 7919) % 1009;
+
+    const auto expected = alg::minmax_element(big, {}, p);
+    auto res = alg::minmax_element(alg::execution::par, big, {}, p);
+
+    EXPECT_EQ(res.min, expected.min);
+    EXPECT_EQ(res.max, expected.max);
+
+    res = alg::minmax_element(alg::execution::par, std::begin(big), std::end(big), pred);
+
+    EXPECT_EQ(res.min, alg::minmax_element(big, pred).min);
+    EXPECT_EQ(res.max, alg::minmax_element(big, pred).max);
+
+    res = alg::minmax_element(alg::execution::seq, big);
+
+    EXPECT_EQ(res.min, alg::minmax_element(big).min);
+    EXPECT_EQ(res.max, alg::minmax_element(big).max);
+}
@@ -1,4 +1,6 @@
 #include <string>
+#include <vector>
+#include <span>
 #include <functional>
 #include <ranges>
 
@@ -6,10 +8,27 @@
 
 #include "modifying_operations.hpp"
 
+struct counter_generator
+{
+    int next{};
+    int* calls;
+
+    int operator()() { ++*calls; return next++; }
+
+    void fill(std::span<int> s)
+    {
+	++*calls;
+	for(auto& v : s)
+	    v = next++;
+    }
+};
+
 class generate_test : public ::testing::Test
 {
 protected:
     std::string s{"abc"};
+    std::vector<int> v{0, 0, 0, 0};
+    int calls{};
     const std::function<char()> gen = [] () { return 'X'; };
 };
 
@@ -81,3 +100,24 @@ TEST_F(generate_test, RangeTestN)
     EXPECT_STREQ(std::data(s), "XXX");
     EXPECT_EQ(res, std::begin(s) + 3);
 }
+
+TEST_F(generate_test, SpanGeneratorTest)
+{
+    auto res = alg::generate(v, counter_generator{1, &calls});
+
+    EXPECT_EQ(v, (std::vector{1, 2, 3, 4}));
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(calls, 1);
+
+    auto res_n = alg::generate_n(std::begin(v), 3, counter_generator{5, &calls});
+
+    EXPECT_EQ(v, (std::vector{5, 6, 7, 4}));
+    EXPECT_EQ(res_n, std::begin(v) + 3);
+    EXPECT_EQ(calls, 2);
+
+    res_n = alg::generate_n(std::begin(v), 0, counter_generator{9, &calls});
+
+    EXPECT_EQ(v, (std::vector{5, 6, 7, 4}));
+    EXPECT_EQ(res_n, std::begin(v));
+    EXPECT_EQ(calls, 2);
+}
@@ -1,4 +1,5 @@
 #include <vector>
+#include <forward_list>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -11,6 +12,8 @@ class shift_left_test : public ::testing::Test
 {
 protected:
     std::vector<movable_int> v{1, 2, 3};
+    std::vector<int> t{1, 2, 3, 4, 5};
+    std::forward_list<int> l{1, 2, 3, 4, 5};
 };
 
 
@@ -46,3 +49,31 @@ TEST_F(shift_left_test, RangeTest)
     EXPECT_EQ(std::begin(res), std::begin(v));
     EXPECT_EQ(std::begin(res), std::begin(v));
 }
+
+TEST_F(shift_left_test, TriviallyCopyableTest)
+{
+    auto res = alg::shift_left(t, 2);
+
+    EXPECT_EQ(t, (std::vector{3, 4, 5, 4, 5}));
+    EXPECT_EQ(std::begin(res), std::begin(t));
+    EXPECT_EQ(std::end(res), std::begin(t) + 3);
+
+    res = alg::shift_left(t, 5);
+
+    EXPECT_EQ(std::begin(res), std::begin(t));
+    EXPECT_EQ(std::end(res), std::begin(t));
+}
+
+TEST_F(shift_left_test, ForwardTest)
+{
+    auto res = alg::shift_left(l, 2);
+
+    EXPECT_EQ(l, (std::forward_list{3, 4, 5, 4, 5}));
+    EXPECT_EQ(std::begin(res), std::begin(l));
+    EXPECT_EQ(std::end(res), std::ranges::next(std::begin(l), 3));
+
+    res = alg::shift_left(l, 6);
+
+    EXPECT_EQ(std::begin(res), std::begin(l));
+    EXPECT_EQ(std::end(res), std::begin(l));
+}
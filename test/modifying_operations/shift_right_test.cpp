@@ -12,6 +12,7 @@ class shift_right_test : public ::testing::Test
 {
 protected:
     std::vector<movable_int> v{1, 2, 3};
+    std::vector<int> t{1, 2, 3, 4, 5};
     std::forward_list<int> l{1, 2, 3};
 };
 
@@ -49,6 +50,20 @@ TEST_F(shift_right_test, RangeTest)
     EXPECT_EQ(std::end(res), std::end(v));
 }
 
+TEST_F(shift_right_test, TriviallyCopyableTest)
+{
+    auto res = alg::shift_right(t, 2);
+
+    EXPECT_EQ((std::vector(std::begin(res), std::end(res))), (std::vector{1, 2, 3}));
+    EXPECT_EQ(std::begin(res), std::begin(t) + 2);
+    EXPECT_EQ(std::end(res), std::end(t));
+
+    res = alg::shift_right(t, 5);
+
+    EXPECT_EQ(std::begin(res), std::end(t));
+    EXPECT_EQ(std::end(res), std::end(t));
+}
+
 TEST_F(shift_right_test, EmptyRangeForward)
 {
     auto res = alg::shift_right(std::begin(l), std::begin(l), 1);
@@ -68,16 +83,28 @@ TEST_F(shift_right_test, BasicTestForward)
 {
     auto res = alg::shift_right(std::begin(l), std::end(l), 1);
 
-    EXPECT_EQ(l, (std::forward_list{3, 1, 2}));
+    EXPECT_TRUE(alg::equal(res, std::forward_list{1, 2}));
     EXPECT_EQ(std::begin(res), std::ranges::next(std::begin(l), 1));
     EXPECT_EQ(std::end(res), std::end(l));
+
+    l = {1, 2, 3, 4, 5};
+    res = alg::shift_right(std::begin(l), std::end(l), 2);
+
+    EXPECT_TRUE(alg::equal(res, std::forward_list{1, 2, 3}));
+    EXPECT_EQ(std::begin(res), std::ranges::next(std::begin(l), 2));
+    EXPECT_EQ(std::end(res), std::end(l));
+
+    res = alg::shift_right(std::begin(l), std::end(l), 5);
+
+    EXPECT_EQ(std::begin(res), std::end(l));
+    EXPECT_EQ(std::end(res), std::end(l));
 }
 
 TEST_F(shift_right_test, RangeTestForward)
 {
     auto res = alg::shift_right(l, 1);
 
-    EXPECT_EQ(l, (std::forward_list{3, 1, 2}));
+    EXPECT_TRUE(alg::equal(res, std::forward_list{1, 2}));
     EXPECT_EQ(std::begin(res), std::ranges::next(std::begin(l), 1));
     EXPECT_EQ(std::end(res), std::end(l));
 }
@@ -1,6 +1,8 @@
 #include <vector>
+#include <array>
 #include <functional>
 #include <ranges>
+#include <algorithm>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +13,8 @@ class swap_ranges_test : public ::testing::Test
 protected:
     std::vector<int> v1{1, 2, 3};
     std::vector<int> v2{4, 5, 6};
+    std::vector<std::array<int, 100>> a1{{1}, {2}, {3}};
+    std::vector<std::array<int, 100>> a2{{4}, {5}, {6}};
 };
 
 
@@ -52,3 +56,48 @@ TEST_F(swap_ranges_test, RangeTest)
     EXPECT_EQ(v1, (std::vector{1, 2, 6}));
     EXPECT_EQ(v2, (std::vector{4, 5, 3}));
 }
+
+TEST_F(swap_ranges_test, LargeElementTest)
+{
+    a1[0][99] = 7;
+    auto res = alg::swap_ranges(a1, a2 | std::views::take(2));
+
+    EXPECT_EQ(res.in1, std::begin(a1) + 2);
+    EXPECT_EQ(res.in2, std::begin(a2) + 2);
+    EXPECT_EQ(a1[0][0], 4);
+    EXPECT_EQ(a1[1][0], 5);
+    EXPECT_EQ(a1[2][0], 3);
+    EXPECT_EQ(a2[0][0], 1);
+    EXPECT_EQ(a2[0][99], 7);
+    EXPECT_EQ(a2[1][0], 2);
+    EXPECT_EQ(a2[2][0], 6);
+
+    alg::iter_swap(std::begin(a1), std::begin(a2));
+
+    EXPECT_EQ(a1[0][0], 1);
+    EXPECT_EQ(a1[0][99], 7);
+    EXPECT_EQ(a2[0][0], 4);
+    EXPECT_EQ(a2[0][99], 0);
+}
+
+TEST_F(swap_ranges_test, SelfSwapTest)
+{
+    a1[0][99] = 7;
+    alg::iter_swap(std::begin(a1), std::begin(a1));
+
+    EXPECT_EQ(a1[0][0], 1);
+    EXPECT_EQ(a1[0][99], 7);
+}
+
+TEST_F(swap_ranges_test, PartialBlockTest)
+{
+    std::vector<char> c1(37, 'a');
+    std::vector<char> c2(41, 'b');
+    auto res = alg::swap_ranges(c1, c2);
+
+    EXPECT_EQ(res.in1, std::end(c1));
+    EXPECT_EQ(res.in2, std::begin(c2) + 37);
+    EXPECT_EQ(c1, std::vector<char>(37, 'b'));
+    EXPECT_EQ(std::count(std::begin(c2), std::end(c2), 'a'), 37);
+    EXPECT_EQ(c2.back(), 'b');
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <compare>
+
+// Element that counts its copies, so tests can tell a move from a copy
+struct counted
+{
+    counted(int k) : key{k} {}
+    counted(const counted& other) : key{other.key} { ++copies; }
+    counted(counted&&) = default;
+    auto operator=(const counted& other) -> counted& { key = other.key; ++copies; return *this; }
+    auto operator=(counted&&) -> counted& = default;
+    auto operator<=>(const counted&) const = default;
+
+    int key;
+    inline static int copies{};
+};
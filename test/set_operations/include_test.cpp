@@ -1,4 +1,8 @@
 #include <vector>
+#include <string>
+#include <compare>
+#include <list>
+#include <algorithm>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -39,3 +43,46 @@ TEST_F(includes_test, ProjectionTest)
     EXPECT_TRUE(alg::includes(v1, v2, {}, p1, p2));
     EXPECT_FALSE(alg::includes(v1, v2, f, p1, p2));
 }
+
+TEST_F(includes_test, GallopTest)
+{
+    std::vector<int> haystack;
+    for(int i{}; i != 20000; ++i)
+	haystack.insert(std::end(haystack), i % 3 ? 1 : 2, i * 5);
+
+    const std::vector<std::vector<int>> needles{
+	{}, {0}, {0, 0}, {0, 0, 0}, {5, 5}, {15, 15, 99995}, {1}, {-5}, {100000},
+	{10, 5000, 5000, 70000}, {10, 5000, 5001}, {99990, 99995}, {99995, 99995}};
+
+    for(const auto& needle : needles) {
+	const bool expected{std::ranges::includes(haystack, needle)};
+	EXPECT_EQ(alg::includes(haystack, needle), expected);
+
+	const std::list<int> lneedle(std::begin(needle), std::end(needle));
+	EXPECT_EQ(alg::includes(haystack, lneedle), expected);
+	EXPECT_EQ(alg::includes(std::list<int>(std::begin(haystack), std::end(haystack)), needle), expected);
+    }
+
+    EXPECT_TRUE(alg::includes(v1, std::vector<char>{'a', 'c', 'f'}, {}, p1, p2));
+    EXPECT_FALSE(alg::includes(v1, std::vector<char>{'a', 'b'}, {}, p1, p2));
+}
+
+TEST_F(includes_test, ThreeWayTest)
+{
+    const std::vector<std::string> acl{"admin", "read", "read", "share", "write"};
+    const std::list<std::string> lacl(std::begin(acl), std::end(acl));
+
+    int calls{};
+    const auto cmp = [&calls] (const std::string& x, const std::string& y) { ++calls; return x <=> y; };
+
+    EXPECT_TRUE(alg::includes(lacl, std::vector<std::string>{"read", "read", "write"}, cmp));
+    EXPECT_LE(calls, 5);
+    EXPECT_FALSE(alg::includes(lacl, std::vector<std::string>{"read", "read", "read"}, cmp));
+    EXPECT_FALSE(alg::includes(lacl, std::vector<std::string>{"delete"}, cmp));
+    EXPECT_TRUE(alg::includes(acl, std::vector<std::string>{"admin", "share"}, cmp));
+    EXPECT_FALSE(alg::includes(acl, std::vector<std::string>{"admin", "zap"}, cmp));
+
+    const auto unordered = [] (char x, char y) { return x == 'c' || y == 'c' ? std::partial_ordering::unordered : x <=> y; };
+    EXPECT_TRUE(alg::includes(v1, std::vector<char>{'a', 'c', 'x'}, unordered));
+    EXPECT_TRUE(alg::includes(v1, v2, std::compare_three_way{}, p1, p2));
+}
@@ -0,0 +1,57 @@
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class jaccard_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v1{1, 2, 2, 4, 5, 6}, v2{2, 2, 2, 5, 7};
+    const std::list<int> l1{1, 2, 2, 4, 5, 6};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p1 = [] (int i) { return i; };
+    const std::function<int(int)> p2 = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(jaccard_test, EmptyRangeTest)
+{
+    EXPECT_DOUBLE_EQ(::alg::jaccard(std::begin(v1), std::begin(v1), std::begin(v2), std::end(v2)), 0.0);
+    EXPECT_DOUBLE_EQ(::alg::jaccard(std::vector<int>{}, std::list<int>{}), 1.0);
+}
+
+TEST_F(jaccard_test, BasicTest)
+{
+    EXPECT_DOUBLE_EQ(::alg::jaccard(std::begin(v1), std::end(v1), std::begin(v2), std::end(v2)), 3.0 / 8.0);
+    EXPECT_DOUBLE_EQ(::alg::jaccard(v1, v2), 3.0 / 8.0);
+    EXPECT_DOUBLE_EQ(::alg::jaccard(l1, v2), 3.0 / 8.0);
+    EXPECT_DOUBLE_EQ(::alg::jaccard(v1, l1), 1.0);
+}
+
+TEST_F(jaccard_test, ProjectionTest)
+{
+    EXPECT_DOUBLE_EQ(::alg::jaccard(v1, v2, {}, p1, p2), 1.0 / 10.0);
+    EXPECT_DOUBLE_EQ(::alg::jaccard(l1, v2, {}, p1, p2), 1.0 / 10.0);
+}
+
+TEST_F(jaccard_test, LargeTest)
+{
+    std::vector<std::uint32_t> a, b;
+    for(std::uint32_t i{}; i != 4000; ++i) {
+	a.push_back(i * 2);
+	b.push_back(i * 3);
+    }
+
+    std::vector<std::uint32_t> common, united;
+    std::ranges::set_intersection(a, b, std::back_inserter(common));
+    std::ranges::set_union(a, b, std::back_inserter(united));
+
+    EXPECT_DOUBLE_EQ(::alg::jaccard(a, b), static_cast<double>(std::size(common)) / static_cast<double>(std::size(united)));
+    EXPECT_DOUBLE_EQ(::alg::jaccard(b, a), ::alg::jaccard(a, b));
+}
@@ -0,0 +1,117 @@
+#include <vector>
+#include <list>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class merge_k_test : public ::testing::Test
+{
+protected:
+    const std::vector<std::vector<int>> runs{{1, 4, 7}, {}, {2, 4, 4, 9}, {0, 3}, {4, 10}};
+    std::vector<int> out{};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return -i; };
+};
+
+
+TEST_F(merge_k_test, EmptyRangeTest)
+{
+    auto res = ::alg::merge_k(std::begin(runs), std::begin(runs), std::back_inserter(out));
+
+    EXPECT_EQ(std::size(out), 0);
+
+    res = ::alg::merge_k(std::vector<std::vector<int>>(3), std::back_inserter(out));
+
+    EXPECT_EQ(std::size(out), 0);
+}
+
+TEST_F(merge_k_test, BasicTest)
+{
+    ::alg::merge_k(std::begin(runs), std::end(runs), std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{0, 1, 2, 3, 4, 4, 4, 4, 7, 9, 10}));
+
+    out.clear();
+    ::alg::merge_k(std::begin(runs), std::begin(runs) + 1, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{1, 4, 7}));
+}
+
+TEST_F(merge_k_test, RangeTest)
+{
+    const std::list<std::list<int>> lists{{5}, {1, 2, 8}, {2, 6}};
+    ::alg::merge_k(lists, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{1, 2, 2, 5, 6, 8}));
+
+    out.clear();
+    const std::vector<std::vector<int>> desc{{7, 4, 1}, {9, 4, 2}};
+    ::alg::merge_k(desc, std::back_inserter(out), f);
+
+    EXPECT_EQ(out, (std::vector{9, 7, 4, 4, 2, 1}));
+}
+
+TEST_F(merge_k_test, ProjectionTest)
+{
+    const std::vector<std::vector<int>> desc{{7, 4, 1}, {9, 4, 2}};
+    ::alg::merge_k(desc, std::back_inserter(out), {}, p);
+
+    EXPECT_EQ(out, (std::vector{9, 7, 4, 4, 2, 1}));
+
+    out.clear();
+    ::alg::merge_k(runs, std::back_inserter(out), f, p);
+
+    EXPECT_EQ(out, (std::vector{0, 1, 2, 3, 4, 4, 4, 4, 7, 9, 10}));
+}
+
+TEST_F(merge_k_test, StabilityTest)
+{
+    using item = std::pair<int, char>;
+    const std::vector<std::vector<item>> items{{{1, 'a'}, {2, 'a'}}, {{1, 'b'}, {2, 'b'}}, {{1, 'c'}}};
+    std::vector<item> merged;
+    ::alg::merge_k(items, std::back_inserter(merged), {}, &item::first);
+
+    EXPECT_EQ(merged, (std::vector<item>{{1, 'a'}, {1, 'b'}, {1, 'c'}, {2, 'a'}, {2, 'b'}}));
+}
+
+TEST_F(merge_k_test, ManyRunsTest)
+{
+    std::vector<std::vector<int>> many(100);
+    std::vector<int> expected;
+    for(int i{}; i != 100; ++i)
+	for(int j{}; j != i % 13; ++j) {
+	    many[i].push_back(j * 7 + i % 5);
+	    expected.push_back(j * 7 + i % 5);
+	}
+    std::ranges::sort(expected);
+
+    ::alg::merge_k(many, std::back_inserter(out));
+
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(merge_k_test, MoveTest)
+{
+    const auto make = [] {
+	return std::vector<std::vector<std::string>>{
+	    {std::string(40, 'a'), std::string(40, 'c')},
+	    {std::string(40, 'b'), std::string(40, 'c')}};
+    };
+
+    std::vector<std::string> merged;
+    ::alg::merge_k(make(), std::back_inserter(merged));
+
+    auto runs{make()};
+    std::vector<std::string> copied;
+    ::alg::merge_k(runs, std::back_inserter(copied));
+
+    EXPECT_EQ(merged, copied);
+    EXPECT_FALSE(runs[0][0].empty());
+    EXPECT_FALSE(runs[1][1].empty());
+}
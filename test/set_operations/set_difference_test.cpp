@@ -1,10 +1,15 @@
 #include <iterator>
 #include <vector>
+#include <string>
+#include <compare>
+#include <utility>
+#include <algorithm>
 #include <functional>
 
 #include <gtest/gtest.h>
 
 #include "set_operations.hpp"
+#include "counted.hpp"
 
 class set_difference_test : public ::testing::Test
 {
@@ -90,3 +95,129 @@ TEST_F(set_difference_test, ProjectionTest)
     EXPECT_EQ(std::size(v3), 5);
     EXPECT_EQ(v3, (std::vector{1, 2, 4, 5, 6}));
 }
+
+TEST_F(set_difference_test, ParallelTest)
+{
+    std::vector<int> a, b;
+    for(int i{}; i != 30000; ++i)
+	a.insert(std::end(a), i % 6, i * 2);
+    for(int i{}; i != 25000; ++i)
+	b.insert(std::end(b), i % 4, i * 3);
+
+    std::vector<int> expected;
+    std::ranges::set_difference(a, b, std::back_inserter(expected));
+
+    std::vector<int> out(std::size(a) + std::size(b));
+    auto res = ::alg::set_difference(::alg::execution::par, a, b, std::begin(out));
+
+    EXPECT_EQ(res.in, std::end(a));
+    out.erase(res.out, std::end(out));
+    EXPECT_EQ(out, expected);
+
+    std::vector<int> seq(std::size(a) + std::size(b));
+    auto sres = ::alg::set_difference(::alg::execution::seq, std::begin(a), std::end(a), std::begin(b), std::end(b), std::begin(seq));
+    seq.erase(sres.out, std::end(seq));
+    EXPECT_EQ(seq, expected);
+
+    using item = std::pair<int, char>;
+    std::vector<item> pa, pb;
+    for(int i : a)
+	pa.emplace_back(-i, 'a');
+    for(int i : b)
+	pb.emplace_back(-i, 'b');
+    std::ranges::reverse(pa);
+    std::ranges::reverse(pb);
+
+    std::vector<item> pexpected;
+    std::ranges::set_difference(pa, pb, std::back_inserter(pexpected), {}, &item::first, &item::first);
+
+    std::vector<item> pout(std::size(pa) + std::size(pb));
+    auto pres = ::alg::set_difference(::alg::execution::par, pa, pb, std::begin(pout), {}, &item::first, &item::first);
+
+    EXPECT_EQ(pres.in, std::end(pa));
+    pout.erase(pres.out, std::end(pout));
+    EXPECT_EQ(pout, pexpected);
+}
+
+TEST_F(set_difference_test, ThreeWayTest)
+{
+    const std::vector<std::string> a{"apple", "kiwi", "kiwi", "lime", "pear", "plum"};
+    const std::vector<std::string> b{"fig", "kiwi", "lime", "lime", "plum", "quince"};
+
+    std::vector<std::string> expected;
+    std::ranges::set_difference(a, b, std::back_inserter(expected));
+
+    int calls{};
+    const auto cmp = [&calls] (const std::string& x, const std::string& y) { ++calls; return x <=> y; };
+
+    std::vector<std::string> out;
+    ::alg::set_difference(a, b, std::back_inserter(out), cmp);
+
+    EXPECT_EQ(out, expected);
+    EXPECT_LE(calls, std::ssize(a) + std::ssize(b));
+
+    out.clear();
+    ::alg::set_difference(std::begin(a), std::end(a), std::begin(b), std::end(b), std::back_inserter(out),
+	std::compare_three_way{}, &std::string::size, &std::string::size);
+    expected.clear();
+    std::ranges::set_difference(a, b, std::back_inserter(expected), {}, &std::string::size, &std::string::size);
+
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(set_difference_test, MoveTest)
+{
+    const auto make = [] { return std::vector<counted>{1, 2, 3, 4, 5}; };
+
+    std::vector<counted> out;
+    out.reserve(10);
+    auto left{make()};
+    std::vector<counted> right{2, 4, 6};
+    counted::copies = 0;
+    auto res = ::alg::set_difference(std::move(left), std::move(right), std::back_inserter(out));
+
+    static_assert(std::same_as<decltype(res.in), std::ranges::dangling>);
+    EXPECT_EQ(counted::copies, 0);
+    EXPECT_EQ(out, (std::vector<counted>{1, 3, 5}));
+
+    out.clear();
+    left = make();
+    right = {2, 4, 6};
+    counted::copies = 0;
+    auto three_way = ::alg::set_difference(std::move(left), std::move(right), std::back_inserter(out), std::compare_three_way{});
+
+    static_assert(std::same_as<decltype(three_way.out), decltype(std::back_inserter(out))>);
+    EXPECT_EQ(counted::copies, 0);
+    EXPECT_EQ(std::size(out), 3);
+
+    out.clear();
+    const auto kept{make()};
+    right = {2, 4, 6};
+    counted::copies = 0;
+    ::alg::set_difference(kept, std::move(right), std::back_inserter(out));
+
+    EXPECT_GT(counted::copies, 0);
+    EXPECT_EQ(std::size(kept), 5);
+
+    std::vector<std::string> words{std::string(40, 'a'), std::string(40, 'b'), std::string(40, 'c')};
+    const std::vector<std::string> other{std::string(40, 'b')};
+    std::vector<std::string> moved;
+    ::alg::set_difference(std::make_move_iterator(std::begin(words)), std::make_move_iterator(std::end(words)),
+	std::begin(other), std::end(other), std::back_inserter(moved));
+
+    EXPECT_EQ(std::size(moved), 2);
+    EXPECT_TRUE(words[0].empty());
+    EXPECT_FALSE(words[1].empty());
+    EXPECT_TRUE(words[2].empty());
+}
+
+TEST_F(set_difference_test, ByValueComparatorMoveTest)
+{
+    std::vector<std::string> out;
+    const auto by_value = [] (std::string a, std::string b) { return a < b; };
+
+    ::alg::set_difference(std::vector<std::string>{"apple", "banana", "cherry"}, std::vector<std::string>{"banana", "date"},
+	std::back_inserter(out), by_value);
+
+    EXPECT_EQ(out, (std::vector<std::string>{"apple", "cherry"}));
+}
@@ -0,0 +1,85 @@
+#include <vector>
+#include <list>
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class set_intersection_inplace_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v1{1, 2, 2, 4, 5, 6};
+    const std::vector<int> v2{2, 5, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p1 = [] (int i) { return i; };
+    const std::function<int(int)> p2 = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(set_intersection_inplace_test, EmptyRangeTest)
+{
+    auto res = ::alg::set_intersection_inplace(std::begin(v1), std::begin(v1), std::begin(v2), std::end(v2));
+
+    EXPECT_EQ(std::begin(res), std::begin(v1));
+    EXPECT_TRUE(res.empty());
+
+    res = ::alg::set_intersection_inplace(std::begin(v1), std::end(v1), std::begin(v2), std::begin(v2));
+
+    EXPECT_EQ(std::begin(res), std::begin(v1));
+    EXPECT_EQ(std::end(res), std::end(v1));
+}
+
+TEST_F(set_intersection_inplace_test, BasicTest)
+{
+    auto res = ::alg::set_intersection_inplace(std::begin(v1), std::end(v1), std::begin(v2), std::end(v2));
+
+    EXPECT_EQ(std::end(res), std::end(v1));
+    v1.erase(std::begin(res), std::end(res));
+    EXPECT_EQ(v1, (std::vector{2, 5}));
+}
+
+TEST_F(set_intersection_inplace_test, RangeTest)
+{
+    std::list<int> l1{1, 2, 2, 4, 5, 6};
+    auto res = ::alg::set_intersection_inplace(l1, std::vector{2, 2, 6});
+    l1.erase(std::begin(res), std::end(res));
+
+    EXPECT_EQ(l1, (std::list{2, 2, 6}));
+
+    std::vector<int> desc{6, 5, 4, 2, 2, 1};
+    auto dres = ::alg::set_intersection_inplace(desc, std::vector{7, 5, 2}, f);
+    desc.erase(std::begin(dres), std::end(dres));
+
+    EXPECT_EQ(desc, (std::vector{5, 2}));
+}
+
+TEST_F(set_intersection_inplace_test, ProjectionTest)
+{
+    auto res = ::alg::set_intersection_inplace(v1, v2, {}, p1, p2);
+    v1.erase(std::begin(res), std::end(res));
+
+    EXPECT_EQ(v1, (std::vector{6}));
+}
+
+TEST_F(set_intersection_inplace_test, MatchesCopyTest)
+{
+    std::vector<std::string> a, b;
+    for(int i{}; i != 500; ++i) {
+	a.insert(std::end(a), i % 3 + 1, std::to_string(1000 + i * 2));
+	b.insert(std::end(b), i % 2 + 1, std::to_string(1000 + i * 3));
+    }
+    std::ranges::sort(a);
+    std::ranges::sort(b);
+
+    std::vector<std::string> expected;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+
+    auto res = ::alg::set_intersection_inplace(a, b);
+    a.erase(std::begin(res), std::end(res));
+
+    EXPECT_EQ(a, expected);
+}
@@ -0,0 +1,64 @@
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class set_intersection_size_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v1{1, 2, 2, 4, 5, 6}, v2{2, 2, 2, 5, 7};
+    const std::list<int> l1{1, 2, 2, 4, 5, 6};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<char(int)> p1 = [] (int i) { return i; };
+    const std::function<char(int)> p2 = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(set_intersection_size_test, EmptyRangeTest)
+{
+    EXPECT_EQ(::alg::set_intersection_size(std::begin(v1), std::begin(v1), std::begin(v2), std::end(v2)), 0);
+    EXPECT_EQ(::alg::set_intersection_size(std::begin(v1), std::end(v1), std::begin(v2), std::begin(v2)), 0);
+    EXPECT_EQ(::alg::set_intersection_size(std::vector<int>{}, std::vector<int>{}), 0);
+}
+
+TEST_F(set_intersection_size_test, BasicTest)
+{
+    EXPECT_EQ(::alg::set_intersection_size(std::begin(v1), std::end(v1), std::begin(v2), std::end(v2)), 3);
+    EXPECT_EQ(::alg::set_intersection_size(v1, v2), 3);
+    EXPECT_EQ(::alg::set_intersection_size(l1, v2), 3);
+    EXPECT_EQ(::alg::set_intersection_size(v1, v2, f), 0);
+}
+
+TEST_F(set_intersection_size_test, ProjectionTest)
+{
+    EXPECT_EQ(::alg::set_intersection_size(v1, v2, {}, p1, p2), 1);
+    EXPECT_EQ(::alg::set_intersection_size(l1, v2, {}, p1, p2), 1);
+}
+
+TEST_F(set_intersection_size_test, LargeTest)
+{
+    std::vector<std::uint32_t> a, b, small{3, 3, 6, 7, 600, 601, 50000};
+    for(std::uint32_t i{}; i != 4000; ++i) {
+	a.insert(std::end(a), i % 5 ? 1 : 2, i * 2);
+	b.push_back(i * 3);
+    }
+
+    std::vector<std::uint32_t> expected;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+    EXPECT_EQ(::alg::set_intersection_size(a, b), std::size(expected));
+
+    expected.clear();
+    std::ranges::set_intersection(b, small, std::back_inserter(expected));
+    EXPECT_EQ(::alg::set_intersection_size(b, small), std::size(expected));
+    EXPECT_EQ(::alg::set_intersection_size(small, b), std::size(expected));
+
+    const std::vector<int> ib(std::begin(b), std::end(b)), ismall(std::begin(small), std::end(small));
+    EXPECT_EQ(std::size(expected), 3);
+    EXPECT_EQ(::alg::set_intersection_size(ib, ismall, f, std::negate{}, std::negate{}), 3);
+}
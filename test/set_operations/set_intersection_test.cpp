@@ -1,5 +1,11 @@
 #include <iterator>
+#include <cstdint>
 #include <vector>
+#include <string>
+#include <compare>
+#include <utility>
+#include <list>
+#include <algorithm>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -98,3 +104,170 @@ TEST_F(set_intersection_test, ProjectionTest)
     EXPECT_EQ(std::size(v3), 0);
     EXPECT_EQ(v3, (std::vector<int>{}));
 }
+
+TEST_F(set_intersection_test, SkewedTest)
+{
+    std::vector<int> big;
+    for(int i{}; i != 5000; ++i)
+	big.insert(std::end(big), i % 7 ? 1 : 2, i * 3);
+    const std::vector<int> small{-3, 0, 0, 0, 9, 21, 21, 22, 4998 * 3, 4999 * 3, 20000};
+
+    std::vector<int> expected;
+    std::ranges::set_intersection(big, small, std::back_inserter(expected));
+
+    auto res = ::alg::set_intersection(big, small, std::back_inserter(v3));
+
+    EXPECT_EQ(res.in1, std::end(big));
+    EXPECT_EQ(res.in2, std::end(small));
+    EXPECT_EQ(v3, expected);
+    EXPECT_EQ(v3, (std::vector{0, 0, 9, 21, 21, 4998 * 3, 4999 * 3}));
+
+    v3.clear();
+    auto sres = ::alg::set_intersection(small, big, std::back_inserter(v3));
+
+    EXPECT_EQ(sres.in1, std::end(small));
+    EXPECT_EQ(sres.in2, std::end(big));
+    EXPECT_EQ(v3, (std::vector{0, 0, 9, 21, 21, 4998 * 3, 4999 * 3}));
+
+    v3.clear();
+    const std::list<int> lbig(std::begin(big), std::end(big));
+    ::alg::set_intersection(lbig, small, std::back_inserter(v3));
+
+    EXPECT_EQ(v3, expected);
+}
+
+TEST_F(set_intersection_test, IntegerKernelTest)
+{
+    std::vector<std::uint32_t> a, b;
+    for(std::uint32_t i{}; i != 3000; ++i) {
+	a.insert(std::end(a), i % 5 ? 1 : 3, i * 2);
+	b.insert(std::end(b), i % 3 ? 1 : 2, i * 3);
+    }
+
+    std::vector<std::uint32_t> expected, out;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+    auto res = ::alg::set_intersection(a, b, std::back_inserter(out));
+
+    EXPECT_EQ(res.in1, std::end(a));
+    EXPECT_EQ(res.in2, std::end(b));
+    EXPECT_EQ(out, expected);
+
+    std::vector<std::uint64_t> big, small{0, 0, 7, 8, 8, 8, 16, 64, 65, 95 * 8 + 1, 2999 * 8, 1ull << 40};
+    for(std::uint64_t i{}; i != 3000; ++i)
+	big.insert(std::end(big), i % 4 ? 1 : 2, i * 8);
+
+    std::vector<std::uint64_t> lexpected, lout;
+    std::ranges::set_intersection(small, big, std::back_inserter(lexpected));
+    ::alg::set_intersection(small, big, std::back_inserter(lout));
+
+    EXPECT_EQ(lout, lexpected);
+    EXPECT_EQ(lout, (std::vector<std::uint64_t>{0, 0, 8, 16, 64, 2999 * 8}));
+
+    lout.clear();
+    ::alg::set_intersection(big, small, std::back_inserter(lout));
+
+    EXPECT_EQ(lout, lexpected);
+}
+
+TEST_F(set_intersection_test, BlockKernelTest)
+{
+    // Distinct values of similar counts go through the block compare, the
+    // duplicates near the end hand the rest over to the lockstep merge
+    std::vector<std::uint32_t> a, b;
+    for(std::uint32_t i{}; i != 5000; ++i) {
+	a.push_back(i * 2 + (i / 100) % 2);
+	b.push_back(i * 3);
+    }
+    b.insert(std::begin(b) + 4000, b[4000]);
+    a.insert(std::begin(a) + 4500, 3, a[4500]);
+
+    std::vector<std::uint32_t> expected, out;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+    ::alg::set_intersection(a, b, std::back_inserter(out));
+
+    EXPECT_EQ(out, expected);
+    EXPECT_EQ(::alg::set_intersection_size(a, b), std::size(expected));
+
+    std::vector<std::uint64_t> la, lb;
+    for(std::uint64_t i{}; i != 5000; ++i) {
+	la.push_back((i * 5) << 33);
+	lb.push_back((i * 7 + i % 3) << 33);
+    }
+
+    std::vector<std::uint64_t> lexpected, lout;
+    std::ranges::set_intersection(la, lb, std::back_inserter(lexpected));
+    ::alg::set_intersection(la, lb, std::back_inserter(lout));
+
+    EXPECT_EQ(lout, lexpected);
+    EXPECT_EQ(::alg::set_intersection_size(lb, la), std::size(lexpected));
+}
+
+TEST_F(set_intersection_test, ParallelTest)
+{
+    std::vector<int> a, b;
+    for(int i{}; i != 30000; ++i)
+	a.insert(std::end(a), i % 6, i * 2);
+    for(int i{}; i != 25000; ++i)
+	b.insert(std::end(b), i % 4, i * 3);
+
+    std::vector<int> expected;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+
+    std::vector<int> out(std::size(a) + std::size(b));
+    auto res = ::alg::set_intersection(::alg::execution::par, a, b, std::begin(out));
+
+    EXPECT_EQ(res.in1, std::end(a));
+    EXPECT_EQ(res.in2, std::end(b));
+    out.erase(res.out, std::end(out));
+    EXPECT_EQ(out, expected);
+
+    std::vector<int> seq(std::size(a) + std::size(b));
+    auto sres = ::alg::set_intersection(::alg::execution::seq, std::begin(a), std::end(a), std::begin(b), std::end(b), std::begin(seq));
+    seq.erase(sres.out, std::end(seq));
+    EXPECT_EQ(seq, expected);
+
+    using item = std::pair<int, char>;
+    std::vector<item> pa, pb;
+    for(int i : a)
+	pa.emplace_back(-i, 'a');
+    for(int i : b)
+	pb.emplace_back(-i, 'b');
+    std::ranges::reverse(pa);
+    std::ranges::reverse(pb);
+
+    std::vector<item> pexpected;
+    std::ranges::set_intersection(pa, pb, std::back_inserter(pexpected), {}, &item::first, &item::first);
+
+    std::vector<item> pout(std::size(pa) + std::size(pb));
+    auto pres = ::alg::set_intersection(::alg::execution::par, pa, pb, std::begin(pout), {}, &item::first, &item::first);
+
+    EXPECT_EQ(pres.in2, std::end(pb));
+    pout.erase(pres.out, std::end(pout));
+    EXPECT_EQ(pout, pexpected);
+}
+
+TEST_F(set_intersection_test, ThreeWayTest)
+{
+    const std::vector<std::string> a{"apple", "kiwi", "kiwi", "lime", "pear", "plum"};
+    const std::vector<std::string> b{"fig", "kiwi", "lime", "lime", "plum", "quince"};
+
+    std::vector<std::string> expected;
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+
+    int calls{};
+    const auto cmp = [&calls] (const std::string& x, const std::string& y) { ++calls; return x <=> y; };
+
+    std::vector<std::string> out;
+    ::alg::set_intersection(a, b, std::back_inserter(out), cmp);
+
+    EXPECT_EQ(out, expected);
+    EXPECT_LE(calls, std::ssize(a) + std::ssize(b));
+
+    out.clear();
+    ::alg::set_intersection(std::begin(a), std::end(a), std::begin(b), std::end(b), std::back_inserter(out),
+	std::compare_three_way{}, &std::string::size, &std::string::size);
+    expected.clear();
+    std::ranges::set_intersection(a, b, std::back_inserter(expected), {}, &std::string::size, &std::string::size);
+
+    EXPECT_EQ(out, expected);
+}
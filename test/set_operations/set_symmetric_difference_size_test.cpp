@@ -0,0 +1,64 @@
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class set_symmetric_difference_size_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v1{1, 2, 2, 4, 5, 6}, v2{2, 2, 2, 5, 7};
+    const std::list<int> l1{1, 2, 2, 4, 5, 6};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p1 = [] (int i) { return i; };
+    const std::function<int(int)> p2 = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(set_symmetric_difference_size_test, EmptyRangeTest)
+{
+    EXPECT_EQ(::alg::set_symmetric_difference_size(std::begin(v1), std::begin(v1), std::begin(v2), std::end(v2)), 5);
+    EXPECT_EQ(::alg::set_symmetric_difference_size(std::vector<int>{}, std::list<int>{}), 0);
+}
+
+TEST_F(set_symmetric_difference_size_test, BasicTest)
+{
+    EXPECT_EQ(::alg::set_symmetric_difference_size(std::begin(v1), std::end(v1), std::begin(v2), std::end(v2)), 5);
+    EXPECT_EQ(::alg::set_symmetric_difference_size(v1, v2), 5);
+    EXPECT_EQ(::alg::set_symmetric_difference_size(l1, v2), 5);
+    EXPECT_EQ(::alg::set_symmetric_difference_size(v2, l1), ::alg::set_symmetric_difference_size(v2, v1));
+}
+
+TEST_F(set_symmetric_difference_size_test, ProjectionTest)
+{
+    EXPECT_EQ(::alg::set_symmetric_difference_size(v1, v2, {}, p1, p2), 9);
+    EXPECT_EQ(::alg::set_symmetric_difference_size(l1, v2, {}, p1, p2), 9);
+}
+
+TEST_F(set_symmetric_difference_size_test, LargeTest)
+{
+    std::vector<std::uint32_t> a, b;
+    for(std::uint32_t i{}; i != 4000; ++i) {
+	a.insert(std::end(a), i % 5 ? 1 : 2, i * 2);
+	if(i % 40 == 0)
+	    b.push_back(i * 3);
+    }
+    const std::list<std::uint32_t> la(std::begin(a), std::end(a));
+
+    for(const auto& [x, y] : {std::pair{a, b}, std::pair{b, a}}) {
+	std::vector<std::uint32_t> expected;
+	std::ranges::set_symmetric_difference(x, y, std::back_inserter(expected));
+	EXPECT_EQ(::alg::set_symmetric_difference_size(x, y), std::size(expected));
+    }
+
+    std::vector<std::uint32_t> expected;
+    const auto& x{a};
+    const auto& y{b};
+    std::ranges::set_symmetric_difference(x, y, std::back_inserter(expected));
+    EXPECT_EQ(::alg::set_symmetric_difference_size(la, b), std::size(expected));
+}
@@ -1,5 +1,9 @@
 #include <iterator>
 #include <vector>
+#include <string>
+#include <compare>
+#include <utility>
+#include <algorithm>
 #include <functional>
 
 #include <gtest/gtest.h>
@@ -73,3 +77,73 @@ TEST_F(set_symmetric_difference_test, ProjectionTest)
     EXPECT_EQ(std::size(v3), 6);
     EXPECT_EQ(v3, (std::vector{1, 2, 2, 4, 5, 7}));
 }
+
+TEST_F(set_symmetric_difference_test, ParallelTest)
+{
+    std::vector<int> a, b;
+    for(int i{}; i != 30000; ++i)
+	a.insert(std::end(a), i % 6, i * 2);
+    for(int i{}; i != 25000; ++i)
+	b.insert(std::end(b), i % 4, i * 3);
+
+    std::vector<int> expected;
+    std::ranges::set_symmetric_difference(a, b, std::back_inserter(expected));
+
+    std::vector<int> out(std::size(a) + std::size(b));
+    auto res = ::alg::set_symmetric_difference(::alg::execution::par, a, b, std::begin(out));
+
+    EXPECT_EQ(res.in1, std::end(a));
+    EXPECT_EQ(res.in2, std::end(b));
+    out.erase(res.out, std::end(out));
+    EXPECT_EQ(out, expected);
+
+    std::vector<int> seq(std::size(a) + std::size(b));
+    auto sres = ::alg::set_symmetric_difference(::alg::execution::seq, std::begin(a), std::end(a), std::begin(b), std::end(b), std::begin(seq));
+    seq.erase(sres.out, std::end(seq));
+    EXPECT_EQ(seq, expected);
+
+    using item = std::pair<int, char>;
+    std::vector<item> pa, pb;
+    for(int i : a)
+	pa.emplace_back(-i, 'a');
+    for(int i : b)
+	pb.emplace_back(-i, 'b');
+    std::ranges::reverse(pa);
+    std::ranges::reverse(pb);
+
+    std::vector<item> pexpected;
+    std::ranges::set_symmetric_difference(pa, pb, std::back_inserter(pexpected), {}, &item::first, &item::first);
+
+    std::vector<item> pout(std::size(pa) + std::size(pb));
+    auto pres = ::alg::set_symmetric_difference(::alg::execution::par, pa, pb, std::begin(pout), {}, &item::first, &item::first);
+
+    EXPECT_EQ(pres.in2, std::end(pb));
+    pout.erase(pres.out, std::end(pout));
+    EXPECT_EQ(pout, pexpected);
+}
+
+TEST_F(set_symmetric_difference_test, ThreeWayTest)
+{
+    const std::vector<std::string> a{"apple", "kiwi", "kiwi", "lime", "pear", "plum"};
+    const std::vector<std::string> b{"fig", "kiwi", "lime", "lime", "plum", "quince"};
+
+    std::vector<std::string> expected;
+    std::ranges::set_symmetric_difference(a, b, std::back_inserter(expected));
+
+    int calls{};
+    const auto cmp = [&calls] (const std::string& x, const std::string& y) { ++calls; return x <=> y; };
+
+    std::vector<std::string> out;
+    ::alg::set_symmetric_difference(a, b, std::back_inserter(out), cmp);
+
+    EXPECT_EQ(out, expected);
+    EXPECT_LE(calls, std::ssize(a) + std::ssize(b));
+
+    out.clear();
+    ::alg::set_symmetric_difference(std::begin(a), std::end(a), std::begin(b), std::end(b), std::back_inserter(out),
+	std::compare_three_way{}, &std::string::size, &std::string::size);
+    expected.clear();
+    std::ranges::set_symmetric_difference(a, b, std::back_inserter(expected), {}, &std::string::size, &std::string::size);
+
+    EXPECT_EQ(out, expected);
+}
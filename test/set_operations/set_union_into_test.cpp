@@ -0,0 +1,88 @@
+#include <vector>
+#include <list>
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class set_union_into_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v1{1, 2, 2, 4, 5, 6};
+    const std::vector<int> v2{2, 2, 2, 5, 7};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p1 = [] (int i) { return i; };
+    const std::function<int(int)> p2 = [] (int i) { return i + 1; };
+};
+
+
+TEST_F(set_union_into_test, EmptyRangeTest)
+{
+    std::vector<int> empty;
+    auto res = ::alg::set_union_into(empty, v2);
+
+    EXPECT_EQ(res, std::end(empty));
+    EXPECT_EQ(empty, v2);
+
+    res = ::alg::set_union_into(v1, std::vector<int>{});
+
+    EXPECT_EQ(res, std::end(v1));
+    EXPECT_EQ(v1, (std::vector{1, 2, 2, 4, 5, 6}));
+}
+
+TEST_F(set_union_into_test, BasicTest)
+{
+    std::vector<int> buffer{1, 2, 2, 4, 5, 6, 0, 0, 0, 0};
+    auto res = ::alg::set_union_into(std::begin(buffer), std::begin(buffer) + 6, std::begin(v2), std::end(v2));
+
+    EXPECT_EQ(res, std::begin(buffer) + 8);
+    EXPECT_EQ(buffer, (std::vector{1, 2, 2, 2, 4, 5, 6, 7, 0, 0}));
+}
+
+TEST_F(set_union_into_test, RangeTest)
+{
+    ::alg::set_union_into(v1, v2);
+
+    EXPECT_EQ(v1, (std::vector{1, 2, 2, 2, 4, 5, 6, 7}));
+
+    std::list<int> l1{6, 5, 4, 2, 2, 1};
+    ::alg::set_union_into(l1, std::list{7, 5, 2, 2, 2}, f);
+
+    EXPECT_EQ(l1, (std::list{7, 6, 5, 4, 2, 2, 2, 1}));
+}
+
+TEST_F(set_union_into_test, ProjectionTest)
+{
+    ::alg::set_union_into(v1, v2, {}, p1, p2);
+
+    EXPECT_EQ(v1, (std::vector{1, 2, 2, 2, 2, 2, 4, 5, 6, 7}));
+}
+
+TEST_F(set_union_into_test, MatchesCopyTest)
+{
+    using item = std::pair<std::string, int>;
+    std::vector<item> a, b;
+    for(int i{}; i != 500; ++i) {
+	for(int j{}; j != i % 3 + 1; ++j)
+	    a.emplace_back(std::to_string(1000 + i * 2), j);
+	for(int j{}; j != i % 4; ++j)
+	    b.emplace_back(std::to_string(1000 + i * 3), 10 + j);
+    }
+    std::ranges::sort(a);
+    std::ranges::sort(b);
+
+    std::vector<item> expected;
+    std::ranges::set_union(a, b, std::back_inserter(expected), {}, &item::first, &item::first);
+
+    a.reserve(std::size(expected));
+    const auto data{a.data()};
+    auto res = ::alg::set_union_into(a, b, {}, &item::first, &item::first);
+
+    EXPECT_EQ(res, std::end(a));
+    EXPECT_EQ(a.data(), data);
+    EXPECT_EQ(a, expected);
+}
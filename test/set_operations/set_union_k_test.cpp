@@ -0,0 +1,109 @@
+#include <vector>
+#include <string>
+#include <list>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "set_operations.hpp"
+
+class set_union_k_test : public ::testing::Test
+{
+protected:
+    const std::vector<std::vector<int>> runs{{1, 4, 4, 7}, {}, {2, 4, 4, 4, 9}, {1, 3}, {4, 10}};
+    std::vector<int> out{};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i / 2; };
+};
+
+
+TEST_F(set_union_k_test, EmptyRangeTest)
+{
+    auto res = ::alg::set_union_k(std::begin(runs), std::begin(runs), std::back_inserter(out));
+
+    EXPECT_EQ(std::size(out), 0);
+
+    res = ::alg::set_union_k(std::vector<std::vector<int>>(3), std::back_inserter(out));
+
+    EXPECT_EQ(std::size(out), 0);
+}
+
+TEST_F(set_union_k_test, BasicTest)
+{
+    ::alg::set_union_k(std::begin(runs), std::end(runs), std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{1, 2, 3, 4, 4, 4, 7, 9, 10}));
+
+    out.clear();
+    ::alg::set_union_k(std::begin(runs), std::begin(runs) + 1, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{1, 4, 4, 7}));
+}
+
+TEST_F(set_union_k_test, RangeTest)
+{
+    const std::list<std::list<int>> lists{{5, 5}, {1, 2, 5, 8}, {2, 6}};
+    ::alg::set_union_k(lists, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector{1, 2, 5, 5, 6, 8}));
+
+    out.clear();
+    const std::vector<std::vector<int>> desc{{7, 4, 1}, {9, 4, 2}};
+    ::alg::set_union_k(desc, std::back_inserter(out), f);
+
+    EXPECT_EQ(out, (std::vector{9, 7, 4, 2, 1}));
+}
+
+TEST_F(set_union_k_test, ProjectionTest)
+{
+    ::alg::set_union_k(runs, std::back_inserter(out), {}, p);
+
+    EXPECT_EQ(out, (std::vector{1, 2, 4, 4, 4, 7, 9, 10}));
+
+    out.clear();
+    const std::vector<std::vector<int>> halves{{2, 4, 5}, {3, 3, 8}};
+    ::alg::set_union_k(halves, std::back_inserter(out), {}, p);
+
+    EXPECT_EQ(out, (std::vector{2, 3, 4, 5, 8}));
+}
+
+TEST_F(set_union_k_test, MatchesPairwiseTest)
+{
+    std::vector<std::vector<int>> many(40);
+    for(int i{}; i != 40; ++i)
+	for(int j{}; j != 30; ++j)
+	    many[i].insert(std::end(many[i]), (i + j) % 4, j * (i % 3 + 1));
+
+    std::vector<int> expected;
+    for(const auto& run : many) {
+	std::vector<int> next;
+	std::ranges::set_union(expected, run, std::back_inserter(next));
+	expected = std::move(next);
+    }
+
+    ::alg::set_union_k(many, std::back_inserter(out));
+
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(set_union_k_test, MoveTest)
+{
+    const auto make = [] {
+	return std::vector<std::vector<std::string>>{
+	    {std::string(40, 'a'), std::string(40, 'c')},
+	    {std::string(40, 'b'), std::string(40, 'c')}};
+    };
+
+    std::vector<std::string> merged;
+    ::alg::set_union_k(make(), std::back_inserter(merged));
+
+    auto runs{make()};
+    std::vector<std::string> copied;
+    ::alg::set_union_k(runs, std::back_inserter(copied));
+
+    EXPECT_EQ(merged, copied);
+    EXPECT_FALSE(runs[0][0].empty());
+    EXPECT_FALSE(runs[1][1].empty());
+}
@@ -0,0 +1,128 @@
+#include <vector>
+#include <string>
+#include <array>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+class nth_element_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v{5, 1, 4, 2, 3, 1};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+
+    static auto shapes(int n) -> std::vector<std::vector<int>>
+    {
+	std::mt19937 gen{0};
+	std::vector<std::vector<int>> result(6, std::vector<int>(n));
+	for(int i{}; i != n; ++i) {
+	    result[0][i] = static_cast<int>(gen());
+	    result[1][i] = i;
+	    result[2][i] = n - i;
+	    result[3][i] = static_cast<int>(gen() % 3);
+	    result[4][i] = 42;
+	    result[5][i] = i < n / 2 ? i : n - i;
+	}
+	return result;
+    }
+
+    // Checks that nth holds the element a full sort would put there and splits the range around it
+    template<typename Range, typename Comp = std::ranges::less, typename Proj = std::identity>
+    static void expect_selected(const Range& data, std::ptrdiff_t nth, const Range& original, Comp f = {}, Proj p = {})
+    {
+	auto sorted{original};
+	std::ranges::stable_sort(sorted, f, p);
+
+	ASSERT_EQ(std::invoke(p, data[nth]), std::invoke(p, sorted[nth]));
+	for(std::ptrdiff_t i{}; i != nth; ++i)
+	    ASSERT_FALSE(std::invoke(f, std::invoke(p, data[nth]), std::invoke(p, data[i])));
+	for(auto i{nth + 1}; i < std::ssize(data); ++i)
+	    ASSERT_FALSE(std::invoke(f, std::invoke(p, data[i]), std::invoke(p, data[nth])));
+	auto elements{data};
+	std::ranges::stable_sort(elements, f, p);
+	EXPECT_EQ(elements, sorted);
+    }
+};
+
+
+TEST_F(nth_element_test, EmptyRange)
+{
+    auto res = alg::nth_element(std::begin(v), std::begin(v), std::begin(v));
+
+    EXPECT_EQ(res, std::begin(v));
+    EXPECT_EQ(v, (std::vector{5, 1, 4, 2, 3, 1}));
+
+    res = alg::nth_element(std::begin(v), std::end(v), std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{5, 1, 4, 2, 3, 1}));
+}
+
+TEST_F(nth_element_test, BasicTest)
+{
+    auto res = alg::nth_element(std::begin(v), std::begin(v) + 3, std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v[3], 3);
+
+    alg::nth_element(std::begin(v), std::begin(v) + 1, std::end(v), f);
+
+    EXPECT_EQ(v[1], 4);
+}
+
+TEST_F(nth_element_test, RangeTest)
+{
+    auto res = alg::nth_element(v, std::begin(v) + 5);
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v[5], 5);
+}
+
+TEST_F(nth_element_test, ProjectionTest)
+{
+    const auto original{v};
+    alg::nth_element(v, std::begin(v) + 2, {}, p);
+
+    expect_selected(v, 2, original, std::ranges::less{}, p);
+
+    using item = std::pair<std::string, int>;
+    std::vector<item> items{{"a", 3}, {"b", 9}, {"c", 1}, {"d", 7}};
+    alg::nth_element(items, std::begin(items), std::ranges::greater{}, &item::second);
+
+    EXPECT_EQ(items.front(), (item{"b", 9}));
+}
+
+TEST_F(nth_element_test, ShapeTest)
+{
+    for(int n : {50, 1000, 100000})
+	for(const auto& original : shapes(n))
+	    for(std::ptrdiff_t nth : {std::ptrdiff_t{}, std::ptrdiff_t{n / 100}, std::ptrdiff_t{n / 2}, std::ptrdiff_t{n - 1}}) {
+		auto data{original};
+		alg::nth_element(data, std::begin(data) + nth);
+		expect_selected(data, nth, original);
+
+		data = original;
+		alg::nth_element(data, std::begin(data) + nth, std::ranges::greater{});
+		expect_selected(data, nth, original, std::ranges::greater{});
+	    }
+}
+
+TEST_F(nth_element_test, ConstexprTest)
+{
+    constexpr auto median = [] {
+	std::array<int, 101> a{};
+	for(int i{}; i != 101; ++i)
+	    a[i] = i * 37 % 101;
+	alg::nth_element(a, std::begin(a) + 50);
+	return a[50];
+    }();
+
+    EXPECT_EQ(median, 50);
+}
@@ -0,0 +1,94 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+class partial_sort_copy_test : public ::testing::Test
+{
+protected:
+    const std::vector<int> v{5, 1, 4, 2, 3, 1};
+    std::vector<int> out = std::vector<int>(3);
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+};
+
+
+TEST_F(partial_sort_copy_test, EmptyRange)
+{
+    auto res = alg::partial_sort_copy(std::begin(v), std::begin(v), std::begin(out), std::end(out));
+
+    EXPECT_EQ(res.in, std::begin(v));
+    EXPECT_EQ(res.out, std::begin(out));
+
+    std::vector<int> kept{9, 9, 9};
+    res = alg::partial_sort_copy(std::begin(v), std::end(v), std::begin(kept), std::begin(kept));
+
+    EXPECT_EQ(res.in, std::end(v));
+    EXPECT_EQ(res.out, std::begin(kept));
+    EXPECT_EQ(kept, (std::vector{9, 9, 9}));
+}
+
+TEST_F(partial_sort_copy_test, BasicTest)
+{
+    auto res = alg::partial_sort_copy(std::begin(v), std::end(v), std::begin(out), std::end(out));
+
+    EXPECT_EQ(res.in, std::end(v));
+    EXPECT_EQ(res.out, std::end(out));
+    EXPECT_EQ(out, (std::vector{1, 1, 2}));
+
+    alg::partial_sort_copy(std::begin(v), std::end(v), std::begin(out), std::end(out), f);
+
+    EXPECT_EQ(out, (std::vector{5, 4, 3}));
+
+    std::vector<int> big(10, -1);
+    auto bres = alg::partial_sort_copy(v, big);
+
+    EXPECT_EQ(bres.out, std::begin(big) + 6);
+    EXPECT_EQ(big, (std::vector{1, 1, 2, 3, 4, 5, -1, -1, -1, -1}));
+}
+
+TEST_F(partial_sort_copy_test, RangeTest)
+{
+    std::istringstream stream{"5 1 4 2 3 1"};
+    auto res = alg::partial_sort_copy(std::views::istream<int>(stream), out);
+
+    EXPECT_EQ(res.out, std::end(out));
+    EXPECT_EQ(out, (std::vector{1, 1, 2}));
+}
+
+TEST_F(partial_sort_copy_test, ProjectionTest)
+{
+    using item = std::pair<std::string, int>;
+    const std::vector<item> items{{"a", 3}, {"b", 9}, {"c", 1}, {"d", 7}};
+    std::vector<item> smallest(2);
+
+    alg::partial_sort_copy(items, smallest, {}, &item::second, &item::second);
+    EXPECT_EQ(smallest, (std::vector<item>{{"c", 1}, {"a", 3}}));
+
+    alg::partial_sort_copy(v, out, {}, p, p);
+    EXPECT_EQ(std::ranges::count(out, 3), 1);
+    EXPECT_TRUE(std::ranges::is_sorted(out, {}, p));
+}
+
+TEST_F(partial_sort_copy_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    std::vector<int> data(50000);
+    for(auto& value : data)
+	value = static_cast<int>(gen() % 10000);
+    auto sorted{data};
+    std::ranges::sort(sorted);
+
+    std::vector<int> smallest(500);
+    alg::partial_sort_copy(data, smallest);
+
+    EXPECT_TRUE(std::equal(std::begin(smallest), std::end(smallest), std::begin(sorted)));
+}
@@ -0,0 +1,80 @@
+#include <vector>
+#include <string>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+class partial_sort_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v{5, 1, 4, 2, 3, 1};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+};
+
+
+TEST_F(partial_sort_test, EmptyRange)
+{
+    auto res = alg::partial_sort(std::begin(v), std::begin(v), std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_TRUE(std::ranges::is_permutation(v, std::vector{5, 1, 4, 2, 3, 1}));
+
+    res = alg::partial_sort(std::begin(v), std::begin(v), std::begin(v));
+
+    EXPECT_EQ(res, std::begin(v));
+}
+
+TEST_F(partial_sort_test, BasicTest)
+{
+    auto res = alg::partial_sort(std::begin(v), std::begin(v) + 3, std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ((std::vector(std::begin(v), std::begin(v) + 3)), (std::vector{1, 1, 2}));
+
+    alg::partial_sort(std::begin(v), std::begin(v) + 2, std::end(v), f);
+
+    EXPECT_EQ((std::vector(std::begin(v), std::begin(v) + 2)), (std::vector{5, 4}));
+}
+
+TEST_F(partial_sort_test, RangeTest)
+{
+    auto res = alg::partial_sort(v, std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{1, 1, 2, 3, 4, 5}));
+}
+
+TEST_F(partial_sort_test, ProjectionTest)
+{
+    alg::partial_sort(v, std::begin(v) + 3, {}, p);
+
+    EXPECT_EQ((std::vector(std::begin(v), std::begin(v) + 3)), (std::vector{3, 1, 4}));
+    EXPECT_TRUE(std::ranges::is_permutation(v, std::vector{5, 1, 4, 2, 3, 1}));
+}
+
+TEST_F(partial_sort_test, LargeTest)
+{
+    std::mt19937 gen{0};
+    std::vector<int> original(100000);
+    for(auto& value : original)
+	value = static_cast<int>(gen() % 50000);
+    auto sorted{original};
+    std::ranges::sort(sorted);
+
+    // Both the heap and the selection strategy
+    for(int k : {1, 10, 1000, 5000, 50000, 100000}) {
+	auto data{original};
+	alg::partial_sort(data, std::begin(data) + k);
+
+	EXPECT_TRUE(std::equal(std::begin(data), std::begin(data) + k, std::begin(sorted)));
+	std::ranges::sort(data);
+	EXPECT_EQ(data, sorted);
+    }
+}
@@ -0,0 +1,177 @@
+#include <vector>
+#include <string>
+#include <memory>
+#include <random>
+#include <limits>
+#include <cstdint>
+#include <cmath>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+template<typename T>
+struct counting_allocator : std::allocator<T>
+{
+    using value_type = T;
+
+    counting_allocator(std::size_t* allocations) : allocations{allocations} {}
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>& other) : allocations{other.allocations} {}
+
+    auto allocate(std::size_t n) -> T*
+    {
+	++*allocations;
+	return std::allocator<T>::allocate(n);
+    }
+
+    template<typename U>
+    struct rebind { using other = counting_allocator<U>; };
+
+    std::size_t* allocations;
+};
+
+class radix_sort_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v{5, -1, 4, -200, 3, 1};
+
+    template<typename T>
+    static auto random_values(std::size_t n, std::uint64_t mask = ~std::uint64_t{}) -> std::vector<T>
+    {
+	std::mt19937_64 gen{0};
+	std::vector<T> values(n);
+	for(auto& value : values)
+	    value = static_cast<T>(gen() & mask);
+	return values;
+    }
+};
+
+
+TEST_F(radix_sort_test, EmptyRange)
+{
+    auto res = alg::radix_sort(std::begin(v), std::begin(v));
+
+    EXPECT_EQ(res, std::begin(v));
+    EXPECT_EQ(v, (std::vector{5, -1, 4, -200, 3, 1}));
+}
+
+TEST_F(radix_sort_test, BasicTest)
+{
+    auto res = alg::radix_sort(std::begin(v), std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{-200, -1, 1, 3, 4, 5}));
+}
+
+TEST_F(radix_sort_test, RangeTest)
+{
+    auto res = alg::radix_sort(v);
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{-200, -1, 1, 3, 4, 5}));
+    static_assert(std::same_as<decltype(alg::radix_sort(std::vector<int>{})), std::ranges::dangling>);
+}
+
+TEST_F(radix_sort_test, IntegerTest)
+{
+    auto u32{random_values<std::uint32_t>(10000)};
+    auto i64{random_values<std::int64_t>(10000)};
+    auto narrow{random_values<std::int64_t>(10000, 0xfff)};
+    auto bytes{random_values<signed char>(1000)};
+
+    for(auto* values : {&i64, &narrow}) {
+	auto expected{*values};
+	std::ranges::sort(expected);
+	alg::radix_sort(*values);
+	EXPECT_EQ(*values, expected);
+    }
+
+    auto expected{u32};
+    std::ranges::sort(expected);
+    alg::radix_sort(u32);
+    EXPECT_EQ(u32, expected);
+
+    auto bexpected{bytes};
+    std::ranges::sort(bexpected);
+    alg::radix_sort(bytes);
+    EXPECT_EQ(bytes, bexpected);
+}
+
+TEST_F(radix_sort_test, FloatingPointTest)
+{
+    constexpr auto inf{std::numeric_limits<double>::infinity()};
+    std::vector<double> d{0.5, -0.0, -inf, 3.25, -1e300, 0.0, inf, -2.5, 1e-300, -1e-300};
+    for(int i{}; i != 200; ++i)
+	d.push_back((i * 7919 % 401 - 200) * 0.125);
+    auto expected{d};
+    std::ranges::sort(expected);
+    alg::radix_sort(d);
+
+    EXPECT_EQ(d, expected);
+    EXPECT_TRUE(std::signbit(*std::ranges::find(d, 0.0)));
+
+    auto f{random_values<std::int32_t>(5000)};
+    std::vector<float> floats;
+    for(auto i : f)
+	floats.push_back(static_cast<float>(i) / 1024.0f);
+    auto fexpected{floats};
+    std::ranges::sort(fexpected);
+    alg::radix_sort(floats);
+
+    EXPECT_EQ(floats, fexpected);
+}
+
+TEST_F(radix_sort_test, ProjectionTest)
+{
+    using item = std::pair<std::string, int>;
+    std::vector<item> items;
+    for(int i{}; i != 3000; ++i)
+	items.emplace_back(std::to_string(i), i * 37 % 101 - 50);
+    auto expected{items};
+    std::ranges::stable_sort(expected, {}, &item::second);
+
+    alg::radix_sort(items, &item::second);
+    EXPECT_EQ(items, expected);
+
+    std::vector<item> small{{"a", 2}, {"b", 1}, {"c", 2}, {"d", 1}};
+    alg::radix_sort(small, [] (const item& i) { return -static_cast<float>(i.second); });
+
+    EXPECT_EQ(small, (std::vector<item>{{"a", 2}, {"c", 2}, {"b", 1}, {"d", 1}}));
+}
+
+TEST_F(radix_sort_test, AllocatorTest)
+{
+    std::size_t allocations{};
+    auto values{random_values<std::uint64_t>(5000)};
+    auto expected{values};
+    std::ranges::sort(expected);
+
+    alg::radix_sort(values, {}, counting_allocator<char>{&allocations});
+
+    EXPECT_EQ(values, expected);
+    EXPECT_EQ(allocations, 1);
+
+    // Keys sharing every byte need no buffer at all
+    std::vector<std::uint64_t> same(1000, 42);
+    alg::radix_sort(same, {}, counting_allocator<char>{&allocations});
+
+    EXPECT_EQ(allocations, 1);
+}
+
+TEST_F(radix_sort_test, MoveOnlyTest)
+{
+    std::vector<std::unique_ptr<int>> ptrs;
+    for(int i{}; i != 500; ++i)
+	ptrs.push_back(std::make_unique<int>(i * 263 % 500));
+
+    alg::radix_sort(ptrs, [] (const std::unique_ptr<int>& p) { return *p; });
+
+    for(int i{}; i != 500; ++i)
+	EXPECT_EQ(*ptrs[i], i);
+}
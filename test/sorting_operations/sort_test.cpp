@@ -0,0 +1,179 @@
+#include <vector>
+#include <string>
+#include <array>
+#include <list>
+#include <deque>
+#include <memory>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+class sort_test : public ::testing::Test
+{
+protected:
+    std::vector<int> v{5, 1, 4, 2, 3, 1};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+
+    // Shapes that trip up naive quicksorts
+    static auto patterns(int n) -> std::vector<std::vector<int>>
+    {
+	std::mt19937 gen{0};
+	std::vector<std::vector<int>> result(8, std::vector<int>(n));
+	for(int i{}; i != n; ++i) {
+	    result[0][i] = static_cast<int>(gen());
+	    result[1][i] = i;
+	    result[2][i] = n - i;
+	    result[3][i] = i < n / 2 ? i : n - i;
+	    result[4][i] = static_cast<int>(gen() % 4);
+	    result[5][i] = 7;
+	    result[6][i] = i % 2 ? i : n - i;
+	    result[7][i] = i % 64 == 0 ? static_cast<int>(gen()) : i;
+	}
+	return result;
+    }
+};
+
+
+TEST_F(sort_test, EmptyRange)
+{
+    auto res = alg::sort(std::begin(v), std::begin(v));
+
+    EXPECT_EQ(res, std::begin(v));
+    EXPECT_EQ(v, (std::vector{5, 1, 4, 2, 3, 1}));
+}
+
+TEST_F(sort_test, BasicTest)
+{
+    auto res = alg::sort(std::begin(v), std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{1, 1, 2, 3, 4, 5}));
+
+    alg::sort(std::begin(v), std::end(v), f);
+
+    EXPECT_EQ(v, (std::vector{5, 4, 3, 2, 1, 1}));
+}
+
+TEST_F(sort_test, RangeTest)
+{
+    auto res = alg::sort(v);
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{1, 1, 2, 3, 4, 5}));
+
+    std::deque<std::string> words{"pear", "fig", "apple", "kiwi"};
+    alg::sort(words, std::ranges::greater{});
+
+    EXPECT_EQ(words, (std::deque<std::string>{"pear", "kiwi", "fig", "apple"}));
+    static_assert(std::same_as<decltype(alg::sort(std::vector<int>{})), std::ranges::dangling>);
+}
+
+TEST_F(sort_test, ProjectionTest)
+{
+    alg::sort(v, {}, p);
+
+    EXPECT_TRUE(std::ranges::is_sorted(v, {}, p));
+    EXPECT_TRUE(std::ranges::is_permutation(v, std::vector{5, 1, 4, 2, 3, 1}));
+
+    using item = std::pair<int, std::string>;
+    std::vector<item> items{{3, "c"}, {1, "a"}, {2, "b"}};
+    alg::sort(items, std::ranges::greater{}, &item::first);
+
+    EXPECT_EQ(items, (std::vector<item>{{3, "c"}, {2, "b"}, {1, "a"}}));
+}
+
+TEST_F(sort_test, PatternTest)
+{
+    for(int n : {10, 100, 1000, 100000})
+	for(auto data : patterns(n)) {
+	    auto expected{data};
+	    std::ranges::sort(expected);
+	    auto descending{data};
+
+	    alg::sort(data);
+	    EXPECT_EQ(data, expected);
+
+	    alg::sort(descending, std::ranges::greater{});
+	    std::ranges::reverse(expected);
+	    EXPECT_EQ(descending, expected);
+	}
+}
+
+TEST_F(sort_test, ComparatorTest)
+{
+    // Non-arithmetic keys take the branching partition
+    for(auto data : patterns(5000)) {
+	std::vector<std::string> words;
+	for(int i : data)
+	    words.push_back(std::to_string(i));
+	auto expected{words};
+	std::ranges::sort(expected);
+
+	alg::sort(words);
+	EXPECT_EQ(words, expected);
+    }
+
+    std::vector<double> values;
+    for(int i{}; i != 3000; ++i)
+	values.push_back((i * 7919) % 3001 * 0.5);
+    auto expected{values};
+    std::ranges::sort(expected, {}, [] (double d) { return -d; });
+    alg::sort(values, {}, [] (double d) { return -d; });
+
+    EXPECT_EQ(values, expected);
+}
+
+TEST_F(sort_test, ConstexprTest)
+{
+    constexpr auto sorted = [] {
+	std::array a{9, 3, 7, 1, 8, 2, 6, 4, 5, 0, 9, 3, 7, 1, 8, 2, 6, 4, 5, 0, 9, 3, 7, 1, 8, 2, 6, 4, 5, 0};
+	alg::sort(a);
+	return a;
+    }();
+
+    EXPECT_TRUE(std::ranges::is_sorted(sorted));
+}
+
+TEST_F(sort_test, ParallelTest)
+{
+    for(auto data : patterns(200000)) {
+	auto expected{data};
+	std::ranges::sort(expected);
+	auto seq{data};
+
+	auto res = alg::sort(alg::execution::par, data);
+	EXPECT_EQ(res, std::end(data));
+	EXPECT_EQ(data, expected);
+
+	alg::sort(alg::execution::seq, std::begin(seq), std::end(seq));
+	EXPECT_EQ(seq, expected);
+    }
+
+    using item = std::pair<int, std::string>;
+    std::vector<item> items;
+    for(int i{}; i != 100000; ++i)
+	items.emplace_back(i * 7919 % 1000, std::to_string(i));
+    auto expected{items};
+    std::ranges::sort(expected, std::ranges::greater{}, &item::first);
+    alg::sort(alg::execution::par, items, std::ranges::greater{}, &item::first);
+
+    EXPECT_TRUE(std::ranges::equal(items, expected, {}, &item::first, &item::first));
+    std::ranges::sort(items);
+    std::ranges::sort(expected);
+    EXPECT_EQ(items, expected);
+
+    std::vector<std::unique_ptr<int>> ptrs;
+    for(int i{}; i != 100000; ++i)
+	ptrs.push_back(std::make_unique<int>(i * 7919 % 100000));
+    alg::sort(alg::execution::par, ptrs, {}, [] (const std::unique_ptr<int>& p) { return *p; });
+
+    for(int i{}; i != 100000; ++i)
+	ASSERT_EQ(*ptrs[i], i);
+}
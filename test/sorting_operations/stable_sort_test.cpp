@@ -0,0 +1,172 @@
+#include <vector>
+#include <string>
+#include <memory>
+#include <random>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "sorting_operations.hpp"
+
+// Refuses requests above a limit the way an exhausted heap would
+template<typename T>
+struct limited_allocator : std::allocator<T>
+{
+    using value_type = T;
+
+    limited_allocator(std::size_t limit) : limit{limit} {}
+
+    template<typename U>
+    limited_allocator(const limited_allocator<U>& other) : limit{other.limit} {}
+
+    auto allocate(std::size_t n) -> T*
+    {
+	if(n > limit)
+	    throw std::bad_alloc{};
+	return std::allocator<T>::allocate(n);
+    }
+
+    template<typename U>
+    struct rebind { using other = limited_allocator<U>; };
+
+    std::size_t limit;
+};
+
+class stable_sort_test : public ::testing::Test
+{
+protected:
+    using item = std::pair<int, int>;
+
+    std::vector<int> v{5, 1, 4, 2, 3, 1};
+    const std::function<bool(int, int)> f = std::ranges::greater();
+    const std::function<int(int)> p = [] (int i) { return i % 3; };
+
+    // Keys with many duplicates, the second member records the original position
+    static auto items(std::vector<int> keys) -> std::vector<item>
+    {
+	std::vector<item> result;
+	for(int i{}; i != std::ssize(keys); ++i)
+	    result.emplace_back(keys[i], i);
+	return result;
+    }
+
+    static auto shapes(int n) -> std::vector<std::vector<int>>
+    {
+	std::mt19937 gen{0};
+	std::vector<std::vector<int>> result(7, std::vector<int>(n));
+	for(int i{}; i != n; ++i) {
+	    result[0][i] = static_cast<int>(gen() % 100);
+	    result[1][i] = i / 3;
+	    result[2][i] = (n - i) / 3;
+	    result[3][i] = i % 1000 / 7;
+	    result[4][i] = i % 4096 < 2048 ? i % 4096 : 8000 - i % 4096;
+	    result[5][i] = i % 50 == 0 ? static_cast<int>(gen() % 1000) : i;
+	    result[6][i] = 1;
+	}
+	return result;
+    }
+};
+
+
+TEST_F(stable_sort_test, EmptyRange)
+{
+    auto res = alg::stable_sort(std::begin(v), std::begin(v));
+
+    EXPECT_EQ(res, std::begin(v));
+    EXPECT_EQ(v, (std::vector{5, 1, 4, 2, 3, 1}));
+}
+
+TEST_F(stable_sort_test, BasicTest)
+{
+    auto res = alg::stable_sort(std::begin(v), std::end(v));
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{1, 1, 2, 3, 4, 5}));
+
+    alg::stable_sort(std::begin(v), std::end(v), f);
+
+    EXPECT_EQ(v, (std::vector{5, 4, 3, 2, 1, 1}));
+}
+
+TEST_F(stable_sort_test, RangeTest)
+{
+    auto res = alg::stable_sort(v);
+
+    EXPECT_EQ(res, std::end(v));
+    EXPECT_EQ(v, (std::vector{1, 1, 2, 3, 4, 5}));
+    static_assert(std::same_as<decltype(alg::stable_sort(std::vector<int>{})), std::ranges::dangling>);
+}
+
+TEST_F(stable_sort_test, ProjectionTest)
+{
+    alg::stable_sort(v, {}, p);
+
+    EXPECT_EQ(v, (std::vector{3, 1, 4, 1, 5, 2}));
+
+    alg::stable_sort(v, f, p);
+
+    EXPECT_EQ(v, (std::vector{5, 2, 1, 4, 1, 3}));
+}
+
+TEST_F(stable_sort_test, StabilityTest)
+{
+    for(int n : {30, 1000, 100000})
+	for(const auto& keys : shapes(n)) {
+	    auto data{items(keys)};
+	    auto expected{data};
+	    std::ranges::stable_sort(expected, {}, &item::first);
+
+	    alg::stable_sort(data, {}, &item::first);
+	    EXPECT_EQ(data, expected);
+
+	    data = items(keys);
+	    expected = data;
+	    std::ranges::stable_sort(expected, std::ranges::greater{}, &item::first);
+
+	    alg::stable_sort(data, std::ranges::greater{}, &item::first);
+	    EXPECT_EQ(data, expected);
+	}
+}
+
+TEST_F(stable_sort_test, RunTest)
+{
+    // Concatenated sorted segments of very different lengths
+    std::vector<int> keys;
+    for(int segment : {50000, 3, 700, 20000, 1, 9000, 64})
+	for(int i{}; i != segment; ++i)
+	    keys.push_back(i * 1000 / segment);
+
+    auto data{items(keys)};
+    auto expected{data};
+    std::ranges::stable_sort(expected, {}, &item::first);
+    alg::stable_sort(data, {}, &item::first);
+
+    EXPECT_EQ(data, expected);
+}
+
+TEST_F(stable_sort_test, LimitedBufferTest)
+{
+    for(std::size_t limit : {std::size_t{}, std::size_t{1}, std::size_t{100}, std::size_t{5000}})
+	for(const auto& keys : shapes(20000)) {
+	    auto data{items(keys)};
+	    auto expected{data};
+	    std::ranges::stable_sort(expected, {}, &item::first);
+
+	    alg::stable_sort(data, {}, &item::first, limited_allocator<item>{limit});
+	    EXPECT_EQ(data, expected);
+	}
+}
+
+TEST_F(stable_sort_test, MoveOnlyTest)
+{
+    std::vector<std::unique_ptr<item>> ptrs;
+    for(const auto& entry : items(shapes(5000)[0]))
+	ptrs.push_back(std::make_unique<item>(entry));
+
+    alg::stable_sort(ptrs, {}, [] (const std::unique_ptr<item>& i) { return i->first; });
+
+    EXPECT_TRUE(std::ranges::is_sorted(ptrs, {}, [] (const std::unique_ptr<item>& i) { return *i; }));
+}